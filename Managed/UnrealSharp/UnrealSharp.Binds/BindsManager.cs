@@ -1,22 +1,33 @@
-﻿namespace UnrealSharp.Binds;
+﻿using System.Runtime.InteropServices;
+
+namespace UnrealSharp.Binds;
+
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct BindsCallbacks
+{
+    public delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr> GetBoundFunction;
+    public delegate* unmanaged[Cdecl]<char*, char**, int*, int, IntPtr*, int> GetBoundFunctions;
+}
 
 public static class NativeBinds
 {
-    private static unsafe delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr> _getBoundFunction = null;
+    private static BindsCallbacks _callbacks;
+    private static bool _initialized;
 
     public static unsafe void Initialize(IntPtr bindsCallbacks)
     {
-        if (_getBoundFunction != null)
+        if (_initialized)
         {
             throw new Exception("NativeBinds.Initialize called twice");
         }
 
-        _getBoundFunction = (delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr>)bindsCallbacks;
+        _callbacks = *(BindsCallbacks*)bindsCallbacks;
+        _initialized = true;
     }
 
     public static unsafe IntPtr TryGetBoundFunction(string outerName, string functionName, int functionSize)
     {
-        if (_getBoundFunction == null)
+        if (!_initialized)
         {
             throw new Exception("NativeBinds not initialized");
         }
@@ -25,7 +36,7 @@ public static class NativeBinds
         fixed (char* outerNamePtr = outerName)
         fixed (char* functionNamePtr = functionName)
         {
-            functionPtr = _getBoundFunction(outerNamePtr, functionNamePtr, functionSize);
+            functionPtr = _callbacks.GetBoundFunction(outerNamePtr, functionNamePtr, functionSize);
         }
 
         if (functionPtr == IntPtr.Zero)
@@ -35,4 +46,53 @@ public static class NativeBinds
 
         return functionPtr;
     }
-}
\ No newline at end of file
+
+    public static unsafe IntPtr[] TryGetBoundFunctions(string outerName, string[] functionNames, int[] functionSizes)
+    {
+        if (!_initialized)
+        {
+            throw new Exception("NativeBinds not initialized");
+        }
+
+        int functionCount = functionNames.Length;
+        IntPtr[] functionPtrs = new IntPtr[functionCount];
+
+        if (functionCount == 0)
+        {
+            return functionPtrs;
+        }
+
+        // Pack every name into one null-separated buffer so all of them can be pinned at once.
+        string packedNames = string.Join('\0', functionNames) + '\0';
+        char** namePtrs = stackalloc char*[functionCount];
+
+        int resolvedCount;
+        fixed (char* outerNamePtr = outerName)
+        fixed (char* packedNamesPtr = packedNames)
+        fixed (int* functionSizesPtr = functionSizes)
+        fixed (IntPtr* functionPtrsPtr = functionPtrs)
+        {
+            char* currentName = packedNamesPtr;
+            for (int i = 0; i < functionCount; i++)
+            {
+                namePtrs[i] = currentName;
+                currentName += functionNames[i].Length + 1;
+            }
+
+            resolvedCount = _callbacks.GetBoundFunctions(outerNamePtr, namePtrs, functionSizesPtr, functionCount, functionPtrsPtr);
+        }
+
+        if (resolvedCount != functionCount)
+        {
+            for (int i = 0; i < functionCount; i++)
+            {
+                if (functionPtrs[i] == IntPtr.Zero)
+                {
+                    throw new Exception($"Failed to find bound function {functionNames[i]} in {outerName}");
+                }
+            }
+        }
+
+        return functionPtrs;
+    }
+}
@@ -0,0 +1,11 @@
+﻿namespace UnrealSharp.Core.Attributes;
+
+/// <summary>
+/// Marks a generated class whose static Register method registers types or modules with the plugin that loads the assembly.
+/// The plugin loader calls them when the assembly is preloaded, which can be on a worker thread. Don't use this attribute in your code.
+/// </summary>
+[AttributeUsage(AttributeTargets.Class)]
+public class GeneratedRegistrarAttribute : Attribute
+{
+    public const string RegisterMethodName = "Register";
+}
\ No newline at end of file
@@ -137,6 +137,14 @@ public sealed class IsBlueprintBaseAttribute(string isBlueprintBase) : Attribute
 [AttributeUsage(AttributeTargets.Class), CustomMetaData]
 public sealed class KismetHideOverridesAttribute(string kismetHideOverrides) : Attribute { }
 
+/// <summary>
+/// [LazyManagedObject]
+/// UnrealSharp only. Objects of this class get their C# counterpart the first time C# accesses them instead of on construction,
+/// so objects that never run C# code skip the managed allocation. The C# constructor is delayed until then as well.
+/// </summary>
+[AttributeUsage(AttributeTargets.Class), CustomMetaData]
+public sealed class LazyManagedObjectAttribute : Attribute { }
+
 /// <summary>
 /// [ProhibitedInterfaces]
 /// Lists Interfaces that are not compatible with the class.
@@ -41,19 +41,27 @@ public static class GCHandleUtilities
     [MethodImpl(MethodImplOptions.NoInlining)]
     public static void Free(GCHandle handle, Assembly? assembly)
     {
+        AssemblyLoadContext? assemblyLoadContext = null;
+        
         if (assembly != null)
         {
-            AssemblyLoadContext? assemblyLoadContext = AssemblyLoadContext.GetLoadContext(assembly);
+            assemblyLoadContext = AssemblyLoadContext.GetLoadContext(assembly);
             
             if (assemblyLoadContext == null)
             {
                 throw new InvalidOperationException("AssemblyLoadContext is null.");
             }
-            
-            if (StrongRefsByAssembly.TryGetValue(assemblyLoadContext, out ConcurrentDictionary<GCHandle, object>? strongReferences))
-            {
-                strongReferences.TryRemove(handle, out _);
-            }
+        }
+
+        Free(handle, assemblyLoadContext);
+    }
+    
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static void Free(GCHandle handle, AssemblyLoadContext? assemblyLoadContext)
+    {
+        if (assemblyLoadContext != null && StrongRefsByAssembly.TryGetValue(assemblyLoadContext, out ConcurrentDictionary<GCHandle, object>? strongReferences))
+        {
+            strongReferences.TryRemove(handle, out _);
         }
 
         handle.Free();
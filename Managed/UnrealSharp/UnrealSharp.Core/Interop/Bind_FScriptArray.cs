@@ -10,4 +10,10 @@ public static unsafe partial class Bind_FScriptArray
     public static delegate* unmanaged<UnmanagedArray*, int> Num;
     public static delegate* unmanaged<UnmanagedArray*, int, int, int, void> Add;
     public static delegate* unmanaged<UnmanagedArray*, void> Destroy;
+    public static delegate* unmanaged<UnmanagedArray*, IntPtr, int, void> Reserve;
+    public static delegate* unmanaged<UnmanagedArray*, IntPtr, int, int, void> InsertZeroed;
+    public static delegate* unmanaged<UnmanagedArray*, IntPtr, int, int, void> RemoveAt;
+    public static delegate* unmanaged<UnmanagedArray*, IntPtr, int, void> SetNumUninitialized;
+    public static delegate* unmanaged<UnmanagedArray*, IntPtr, void> Shrink;
+    public static delegate* unmanaged<UnmanagedArray*, IntPtr, IntPtr, int, void> Append;
 }
\ No newline at end of file
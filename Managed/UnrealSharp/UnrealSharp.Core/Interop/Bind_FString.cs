@@ -7,4 +7,5 @@ public static unsafe partial class Bind_FString
 {
     public static delegate* unmanaged<UnmanagedArray*, string, void> MarshalToNativeString;
     public static delegate* unmanaged<UnmanagedArray*, char*, int, void> MarshalToNativeStringView;
+    public static delegate* unmanaged<UnmanagedArray*, char*, int*, int, void> MarshalToNativeStringArray;
 }
@@ -12,12 +12,14 @@ public unsafe struct ManagedCallbacks
     
     public delegate* unmanaged<IntPtr, void> InvokeDelegate;
     public delegate* unmanaged<IntPtr, char*, IntPtr> GetManagedMethod;
+    public delegate* unmanaged<IntPtr, char**, int, IntPtr*, IntPtr*, int> GetManagedMethods;
     public delegate* unmanaged<IntPtr, char*, IntPtr> GetManagedTypeHandle;
     
     public delegate* unmanaged<IntPtr, IntPtr, void> InitializeStruct;
     
     public delegate* unmanaged<IntPtr, IntPtr, void> Dispose;
     public delegate* unmanaged<IntPtr, void> FreeHandle;
+    public delegate* unmanaged<IntPtr*, int, void> DisposeBatch;
 
     public static void Initialize(IntPtr outManagedCallbacks)
     {
@@ -28,11 +30,13 @@ public unsafe struct ManagedCallbacks
             InvokeManagedMethod = &UnmanagedCallbacks.InvokeManagedMethod,
             InvokeDelegate = &UnmanagedCallbacks.InvokeDelegate,
             GetManagedMethod = &UnmanagedCallbacks.GetManagedMethod,
+            GetManagedMethods = &UnmanagedCallbacks.GetManagedMethods,
             GetManagedTypeHandle = &UnmanagedCallbacks.GetManagedTypeHandle,
             InitializeStruct = &UnmanagedCallbacks.InitializeStruct,
             
             Dispose = &UnmanagedCallbacks.Dispose,
             FreeHandle = &UnmanagedCallbacks.FreeHandle,
+            DisposeBatch = &UnmanagedCallbacks.DisposeBatch,
         };
     }
 }
\ No newline at end of file
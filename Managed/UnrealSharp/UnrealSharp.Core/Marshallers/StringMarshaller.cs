@@ -1,3 +1,4 @@
+using System.Buffers;
 using UnrealSharp.Core.Interop;
 
 namespace UnrealSharp.Core.Marshallers;
@@ -25,6 +26,48 @@ public static class StringMarshaller
         }
     }
     
+    // Marshals every string into a TArray<FString> in one native call. The strings are packed into a pooled buffer,
+    // and the native side reuses the allocations of the strings already in the array.
+    public static void ToNativeArray(IntPtr nativeArray, IList<string> strings)
+    {
+        int count = strings.Count;
+        int totalLength = 0;
+        
+        for (int i = 0; i < count; i++)
+        {
+            totalLength += strings[i]?.Length ?? 0;
+        }
+        
+        char[] packedStrings = ArrayPool<char>.Shared.Rent(Math.Max(totalLength, 1));
+        int[] lengths = ArrayPool<int>.Shared.Rent(Math.Max(count, 1));
+
+        try
+        {
+            int offset = 0;
+            for (int i = 0; i < count; i++)
+            {
+                string value = strings[i] ?? string.Empty;
+                value.CopyTo(0, packedStrings, offset, value.Length);
+                lengths[i] = value.Length;
+                offset += value.Length;
+            }
+
+            unsafe
+            {
+                fixed (char* packedStringsPtr = packedStrings)
+                fixed (int* lengthsPtr = lengths)
+                {
+                    Bind_FString.CallMarshalToNativeStringArray((UnmanagedArray*) nativeArray, packedStringsPtr, lengthsPtr, count);
+                }
+            }
+        }
+        finally
+        {
+            ArrayPool<char>.Shared.Return(packedStrings);
+            ArrayPool<int>.Shared.Return(lengths);
+        }
+    }
+    
     public static string FromNative(IntPtr nativeBuffer, int arrayIndex)
     {
         unsafe
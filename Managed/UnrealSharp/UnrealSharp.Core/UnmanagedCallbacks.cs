@@ -1,5 +1,6 @@
 ﻿using System.Reflection;
 using System.Runtime.InteropServices;
+using System.Runtime.Loader;
 using UnrealSharp.Core.Attributes;
 using UnrealSharp.Core.Marshallers;
 
@@ -120,6 +121,77 @@ public static class UnmanagedCallbacks
         return IntPtr.Zero;
     }
     
+    [UnmanagedCallersOnly]
+    public static unsafe int GetManagedMethods(IntPtr typeHandlePtr, char** functionNames, int functionCount, IntPtr* outMethodHandles, IntPtr* outUnmanagedInvokers)
+    {
+        try
+        {
+            Type? type = GCHandleUtilities.GetObjectFromHandlePtr<Type>(typeHandlePtr);
+            
+            if (type == null)
+            {
+                throw new Exception("Invalid type handle");
+            }
+            
+            // Collect every invoker of the type once, keyed by the UFunction name. Derived types take precedence.
+            const string invokerPrefix = "Invoke_";
+            const string unmanagedInvokerPrefix = "InvokeUnmanaged_";
+            BindingFlags flags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static | BindingFlags.DeclaredOnly;
+            Dictionary<string, MethodInfo> invokers = new Dictionary<string, MethodInfo>();
+            Dictionary<string, MethodInfo> unmanagedInvokers = new Dictionary<string, MethodInfo>();
+            
+            for (Type? currentType = type; currentType != null; currentType = currentType.BaseType)
+            {
+                foreach (MethodInfo method in currentType.GetMethods(flags))
+                {
+                    if (method.Name.StartsWith(invokerPrefix, StringComparison.Ordinal))
+                    {
+                        invokers.TryAdd(method.Name.Substring(invokerPrefix.Length), method);
+                    }
+                    else if (method.Name.StartsWith(unmanagedInvokerPrefix, StringComparison.Ordinal) && method.IsDefined(typeof(UnmanagedCallersOnlyAttribute)))
+                    {
+                        unmanagedInvokers.TryAdd(method.Name.Substring(unmanagedInvokerPrefix.Length), method);
+                    }
+                }
+            }
+            
+            Dictionary<string, MethodInfo>.AlternateLookup<ReadOnlySpan<char>> invokerLookup = invokers.GetAlternateLookup<ReadOnlySpan<char>>();
+            Dictionary<string, MethodInfo>.AlternateLookup<ReadOnlySpan<char>> unmanagedInvokerLookup = unmanagedInvokers.GetAlternateLookup<ReadOnlySpan<char>>();
+            int foundCount = 0;
+            
+            for (int i = 0; i < functionCount; i++)
+            {
+                ReadOnlySpan<char> functionName = MemoryMarshal.CreateReadOnlySpanFromNullTerminated(functionNames[i]);
+                outUnmanagedInvokers[i] = IntPtr.Zero;
+                
+                if (!invokerLookup.TryGetValue(functionName, out MethodInfo? method))
+                {
+                    outMethodHandles[i] = IntPtr.Zero;
+                    continue;
+                }
+                
+                IntPtr functionPtr = method.MethodHandle.GetFunctionPointer();
+                GCHandle methodHandle = GCHandleUtilities.AllocateStrongPointer(functionPtr, type.Assembly);
+                outMethodHandles[i] = GCHandle.ToIntPtr(methodHandle);
+                foundCount++;
+                
+                // Only use the entry point generated next to this exact invoker, otherwise native would skip an override.
+                if (unmanagedInvokerLookup.TryGetValue(functionName, out MethodInfo? unmanagedInvoker) && unmanagedInvoker.DeclaringType == method.DeclaringType)
+                {
+                    outUnmanagedInvokers[i] = unmanagedInvoker.MethodHandle.GetFunctionPointer();
+                }
+            }
+
+            return foundCount;
+        }
+        catch (Exception e)
+        {
+            LogUnrealSharpCore.LogError($"Exception while trying to look up managed methods: {e.Message}");
+        }
+
+        return 0;
+    }
+    
     [UnmanagedCallersOnly]
     public static void InitializeStruct(IntPtr structHandle, IntPtr buffer)
     {
@@ -221,12 +293,18 @@ public static class UnmanagedCallbacks
         }
         catch (Exception ex)
         {
-            StringMarshaller.ToNative(exceptionTextBuffer, 0, ex.ToString());
-            LogUnrealSharpCore.LogError($"Exception during InvokeManagedMethod: {ex.Message}");
-            return 1;
+            return HandleInvokeException(ex, exceptionTextBuffer);
         }
     }
 
+    // Shared by InvokeManagedMethod and the generated InvokeUnmanaged_ entry points.
+    public static int HandleInvokeException(Exception ex, IntPtr exceptionTextBuffer)
+    {
+        StringMarshaller.ToNative(exceptionTextBuffer, 0, ex.ToString());
+        LogUnrealSharpCore.LogError($"Exception during InvokeManagedMethod: {ex.Message}");
+        return 1;
+    }
+
     [UnmanagedCallersOnly]
     public static void InvokeDelegate(IntPtr delegatePtr)
     {
@@ -266,6 +344,41 @@ public static class UnmanagedCallbacks
         GCHandleUtilities.Free(foundHandle, foundAssembly);
     }
 
+    // Disposes every object purged since the last flush and frees their handles.
+    // Each entry is an object handle followed by the handle of its owning assembly.
+    [UnmanagedCallersOnly]
+    public static unsafe void DisposeBatch(IntPtr* disposals, int count)
+    {
+        IntPtr lastAssemblyHandle = IntPtr.Zero;
+        AssemblyLoadContext? lastLoadContext = null;
+        
+        for (int i = 0; i < count; i++)
+        {
+            GCHandle foundHandle = GCHandle.FromIntPtr(disposals[i * 2]);
+            
+            if (!foundHandle.IsAllocated)
+            {
+                continue;
+            }
+            
+            if (foundHandle.Target is IDisposable disposable)
+            {
+                disposable.Dispose();
+            }
+            
+            // Objects of the same assembly are usually purged together.
+            IntPtr assemblyHandle = disposals[i * 2 + 1];
+            if (assemblyHandle != lastAssemblyHandle)
+            {
+                Assembly? foundAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+                lastLoadContext = foundAssembly != null ? AssemblyLoadContext.GetLoadContext(foundAssembly) : null;
+                lastAssemblyHandle = assemblyHandle;
+            }
+            
+            GCHandleUtilities.Free(foundHandle, lastLoadContext);
+        }
+    }
+
     [UnmanagedCallersOnly]
     public static void FreeHandle(IntPtr handle)
     {
@@ -0,0 +1,186 @@
+using System.Diagnostics;
+using UnrealSharp.Core;
+using UnrealSharp.CoreUObject;
+
+namespace UnrealSharp.Editor.Benchmarks;
+
+/// <summary>
+/// The C# half of the CSInteropBenchmark commandlet. Calls the interop APIs the way game code does, so the numbers
+/// include the managed to native transition and the managed allocations of each call.
+/// </summary>
+internal unsafe class InteropBenchmarks
+{
+    private readonly long _iterations;
+    private readonly IntPtr _context;
+    private readonly delegate* unmanaged<IntPtr, void> _beginSample;
+    private readonly delegate* unmanaged<IntPtr, char*, long, double, long, void> _endSample;
+
+    private InteropBenchmarks(long iterations, IntPtr context, IntPtr beginSample, IntPtr endSample)
+    {
+        _iterations = iterations;
+        _context = context;
+        _beginSample = (delegate* unmanaged<IntPtr, void>) beginSample;
+        _endSample = (delegate* unmanaged<IntPtr, char*, long, double, long, void>) endSample;
+    }
+
+    public static void RunAll(long iterations, IntPtr context, IntPtr beginSample, IntPtr endSample)
+    {
+        InteropBenchmarks benchmarks = new InteropBenchmarks(iterations, context, beginSample, endSample);
+        UInteropBenchmarkFixture fixture = UObject.NewObject<UInteropBenchmarkFixture>();
+
+        try
+        {
+            benchmarks.RunPropertyBenchmarks(fixture);
+            benchmarks.RunStringBenchmarks();
+            benchmarks.RunContainerBenchmarks(fixture);
+            benchmarks.RunObjectCreationBenchmark();
+        }
+        finally
+        {
+            fixture.MarkAsGarbage();
+        }
+    }
+
+    private void RunPropertyBenchmarks(UInteropBenchmarkFixture fixture)
+    {
+        Run("UObject.GetProperty.Int32", _iterations, index =>
+        {
+            _ = fixture.IntValue;
+        });
+
+        Run("UObject.SetProperty.Int32", _iterations, index =>
+        {
+            fixture.IntValue = (int) index;
+        });
+
+        fixture.StringValue = "UnrealSharp interop benchmark string";
+        Run("UObject.GetProperty.String", _iterations, index =>
+        {
+            _ = fixture.StringValue;
+        });
+    }
+
+    private void RunStringBenchmarks()
+    {
+        const string source = "UnrealSharp interop benchmark string";
+
+        Run("FName.FromString", _iterations, index =>
+        {
+            _ = new FName(source);
+        });
+
+        FName name = new FName(source);
+        Run("FName.ToString", _iterations, index =>
+        {
+            _ = name.ToString();
+        });
+
+        Run("FText.FromString", _iterations, index =>
+        {
+            _ = new FText(source);
+        });
+
+        FText text = new FText(source);
+        Run("FText.ToString", _iterations, index =>
+        {
+            _ = text.ToString();
+        });
+    }
+
+    private void RunContainerBenchmarks(UInteropBenchmarkFixture fixture)
+    {
+        TArray<FVector> vectors = fixture.Vectors;
+        Run("TArray.Add.64xFVector", _iterations, index =>
+        {
+            vectors.Clear();
+            for (int i = 0; i < 64; i++)
+            {
+                vectors.Add(FVector.One);
+            }
+        });
+
+        // Keys wrap around so the containers stay a fixed size, and every add after the first round updates an existing entry.
+        TMap<int, int> intMap = fixture.IntMap;
+        Run("TMap.Set.Int32", _iterations, index =>
+        {
+            int key = (int) (index & 1023);
+            intMap[key] = key;
+        });
+
+        Run("TMap.ContainsKey.Int32", _iterations, index =>
+        {
+            _ = intMap.ContainsKey((int) (index & 1023));
+        });
+
+        Run("TMap.Enumerate.Int32", Math.Max(_iterations / 1000, 1), index =>
+        {
+            foreach (KeyValuePair<int, int> pair in intMap)
+            {
+                _ = pair.Value;
+            }
+        });
+
+        TSet<int> intSet = fixture.IntSet;
+        Run("TSet.Add.Int32", _iterations, index =>
+        {
+            intSet.Add((int) (index & 1023));
+        });
+
+        Run("TSet.Contains.Int32", _iterations, index =>
+        {
+            _ = intSet.Contains((int) (index & 1023));
+        });
+    }
+
+    private void RunObjectCreationBenchmark()
+    {
+        // Every iteration creates a new object, so this runs fewer iterations to keep the number of live objects down.
+        long iterations = Math.Min(_iterations, 10000);
+        List<UInteropBenchmarkFixture> objects = new List<UInteropBenchmarkFixture>((int) (GetNumWarmupIterations(iterations) + iterations));
+
+        Run("UObject.NewObject", iterations, index =>
+        {
+            objects.Add(UObject.NewObject<UInteropBenchmarkFixture>());
+        });
+
+        foreach (UInteropBenchmarkFixture obj in objects)
+        {
+            obj.MarkAsGarbage();
+        }
+    }
+
+    private static long GetNumWarmupIterations(long iterations)
+    {
+        return Math.Min(iterations / 10, 1000);
+    }
+
+    // Same shape as the native runner: a short warmup, then the measured iterations continuing the index after it.
+    private void Run(string name, long iterations, Action<long> body)
+    {
+        long numWarmupIterations = GetNumWarmupIterations(iterations);
+        for (long index = 0; index < numWarmupIterations; index++)
+        {
+            body(index);
+        }
+
+        _beginSample(_context);
+
+        long startBytes = GC.GetAllocatedBytesForCurrentThread();
+        long startTimestamp = Stopwatch.GetTimestamp();
+
+        for (long index = numWarmupIterations; index < numWarmupIterations + iterations; index++)
+        {
+            body(index);
+        }
+
+        long endTimestamp = Stopwatch.GetTimestamp();
+        long managedBytes = GC.GetAllocatedBytesForCurrentThread() - startBytes;
+
+        double nanoseconds = (endTimestamp - startTimestamp) * (1_000_000_000.0 / Stopwatch.Frequency);
+
+        fixed (char* namePtr = name)
+        {
+            _endSample(_context, namePtr, iterations, nanoseconds, managedBytes);
+        }
+    }
+}
@@ -0,0 +1,30 @@
+using UnrealSharp.Attributes;
+using UnrealSharp.CoreUObject;
+
+namespace UnrealSharp.Editor.Benchmarks;
+
+/// <summary>
+/// Target of the CSInteropBenchmark commandlet. The C# benchmarks in <see cref="InteropBenchmarks"/> operate on its properties,
+/// and its functions are the Blueprint to C# benchmarks when no -ManagedFunctions are given.
+/// The functions do no work of their own, so the numbers measure the call into C#.
+/// </summary>
+[UClass]
+public partial class UInteropBenchmarkFixture : UObject
+{
+    [UProperty] public partial int IntValue { get; set; }
+    [UProperty] public partial string StringValue { get; set; }
+    [UProperty] public partial TArray<FVector> Vectors { get; set; }
+    [UProperty] public partial TMap<int, int> IntMap { get; set; }
+    [UProperty] public partial TSet<int> IntSet { get; set; }
+
+    [UFunction(FunctionFlags.BlueprintCallable)]
+    public void NoParams()
+    {
+    }
+
+    [UFunction(FunctionFlags.BlueprintCallable)]
+    public int AddInts(int a, int b)
+    {
+        return a + b;
+    }
+}
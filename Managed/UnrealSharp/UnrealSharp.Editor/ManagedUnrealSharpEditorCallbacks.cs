@@ -2,6 +2,7 @@ using System.Diagnostics;
 using System.Runtime.InteropServices;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Marshallers;
+using UnrealSharp.Editor.Benchmarks;
 
 namespace UnrealSharp.Editor;
 
@@ -20,6 +21,8 @@ public unsafe struct FManagedUnrealSharpEditorCallbacks()
     
     public delegate* unmanaged<char*, IntPtr, void> LoadSolution = &ManagedUnrealSharpEditorCallbacks.LoadSolution;
     public delegate* unmanaged<char*, IntPtr, void> LoadProject = &ManagedUnrealSharpEditorCallbacks.LoadProject;
+    
+    public delegate* unmanaged<long, IntPtr, IntPtr, IntPtr, void> RunInteropBenchmarks = &ManagedUnrealSharpEditorCallbacks.RunInteropBenchmarks;
 }
 
 public static class ManagedUnrealSharpEditorCallbacks
@@ -137,6 +140,19 @@ public static class ManagedUnrealSharpEditorCallbacks
         }
     }
     
+    [UnmanagedCallersOnly]
+    public static void RunInteropBenchmarks(long iterations, IntPtr context, IntPtr beginSample, IntPtr endSample)
+    {
+        try
+        {
+            InteropBenchmarks.RunAll(iterations, context, beginSample, endSample);
+        }
+        catch (Exception exception)
+        {
+            LogUnrealSharpEditor.LogError($"Interop benchmarks failed: {exception}");
+        }
+    }
+    
     [UnmanagedCallersOnly]
     public static unsafe void RemoveSourceFile(char* projectName, char* filePath)
     {
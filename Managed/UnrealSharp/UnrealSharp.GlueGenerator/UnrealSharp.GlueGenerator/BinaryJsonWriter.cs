@@ -0,0 +1,256 @@
+using Newtonsoft.Json;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+namespace UnrealSharp.GlueGenerator;
+
+// Writes the same document as JsonTextWriter, but in the compact binary layout read by UnrealSharp::RapidJson::ParseBinaryJson.
+// Every key and string value is interned into a table so repeated names (flags, metadata keys, namespaces) are only stored once.
+public sealed class BinaryJsonWriter : JsonWriter
+{
+    private const uint Magic = 0x4A425355; // "USBJ"
+    private const ushort Version = 1;
+
+    private enum Token : byte
+    {
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        Key,
+        String,
+        Int,
+        True,
+        False,
+        Null,
+        Double,
+    }
+
+    private readonly MemoryStream _tokens = new();
+    private readonly List<string> _strings = new();
+    private readonly Dictionary<string, int> _stringIndices = new();
+
+    public override void Flush()
+    {
+    }
+
+    public override void WriteStartObject()
+    {
+        base.WriteStartObject();
+        WriteToken(Token.StartObject);
+    }
+
+    public override void WriteStartArray()
+    {
+        base.WriteStartArray();
+        WriteToken(Token.StartArray);
+    }
+
+    protected override void WriteEnd(JsonToken token)
+    {
+        WriteToken(token == JsonToken.EndObject ? Token.EndObject : Token.EndArray);
+    }
+
+    public override void WritePropertyName(string name)
+    {
+        base.WritePropertyName(name);
+        WriteToken(Token.Key);
+        WriteVarUInt((ulong) InternString(name));
+    }
+
+    public override void WriteValue(string? value)
+    {
+        base.WriteValue(value);
+
+        if (value == null)
+        {
+            WriteToken(Token.Null);
+            return;
+        }
+
+        WriteToken(Token.String);
+        WriteVarUInt((ulong) InternString(value));
+    }
+
+    public override void WriteValue(bool value)
+    {
+        base.WriteValue(value);
+        WriteToken(value ? Token.True : Token.False);
+    }
+
+    public override void WriteValue(int value)
+    {
+        base.WriteValue(value);
+        WriteInt(value);
+    }
+
+    public override void WriteValue(uint value)
+    {
+        base.WriteValue(value);
+        WriteInt(value);
+    }
+
+    public override void WriteValue(long value)
+    {
+        base.WriteValue(value);
+        WriteInt(value);
+    }
+
+    public override void WriteValue(double value)
+    {
+        base.WriteValue(value);
+        WriteToken(Token.Double);
+        byte[] bytes = BitConverter.GetBytes(value);
+        _tokens.Write(bytes, 0, bytes.Length);
+    }
+
+    public override void WriteValue(float value)
+    {
+        WriteValue((double) value);
+    }
+
+    public override void WriteValue(ulong value)
+    {
+        WriteValue(checked((long) value));
+    }
+
+    public override void WriteValue(short value)
+    {
+        WriteValue((int) value);
+    }
+
+    public override void WriteValue(ushort value)
+    {
+        WriteValue((int) value);
+    }
+
+    public override void WriteValue(byte value)
+    {
+        WriteValue((int) value);
+    }
+
+    public override void WriteValue(sbyte value)
+    {
+        WriteValue((int) value);
+    }
+
+    public override void WriteValue(char value)
+    {
+        WriteValue(value.ToString());
+    }
+
+    // The native reader has no tokens for these. Anything that would write them has to fail here instead of
+    // leaving the token stream out of sync with the document. Nullable overloads forward to these or to WriteNull.
+    public override void WriteValue(decimal value) => throw Unsupported(nameof(Decimal));
+    public override void WriteValue(DateTime value) => throw Unsupported(nameof(DateTime));
+    public override void WriteValue(DateTimeOffset value) => throw Unsupported(nameof(DateTimeOffset));
+    public override void WriteValue(Guid value) => throw Unsupported(nameof(Guid));
+    public override void WriteValue(TimeSpan value) => throw Unsupported(nameof(TimeSpan));
+
+    public override void WriteValue(Uri? value)
+    {
+        if (value != null)
+        {
+            throw Unsupported(nameof(Uri));
+        }
+
+        WriteNull();
+    }
+
+    public override void WriteValue(byte[]? value)
+    {
+        if (value != null)
+        {
+            throw Unsupported("byte[]");
+        }
+
+        WriteNull();
+    }
+
+    public override void WriteUndefined() => throw Unsupported("undefined");
+    public override void WriteRaw(string? json) => throw Unsupported("raw JSON");
+    public override void WriteRawValue(string? json) => throw Unsupported("raw JSON");
+    public override void WriteComment(string? text) => throw Unsupported("comments");
+    public override void WriteStartConstructor(string name) => throw Unsupported("constructors");
+
+    public override void WriteNull()
+    {
+        base.WriteNull();
+        WriteToken(Token.Null);
+    }
+
+    // Header, string table and token stream. The content hash covers everything after the header,
+    // so the native side can detect unchanged types without decoding them.
+    public byte[] ToArray()
+    {
+        using MemoryStream payload = new MemoryStream();
+
+        WriteVarUInt(payload, (ulong) _strings.Count);
+        foreach (string value in _strings)
+        {
+            byte[] chars = Encoding.Unicode.GetBytes(value);
+            WriteVarUInt(payload, (ulong) value.Length);
+            payload.Write(chars, 0, chars.Length);
+        }
+
+        _tokens.WriteTo(payload);
+        byte[] payloadBytes = payload.ToArray();
+
+        using MemoryStream result = new MemoryStream(16 + payloadBytes.Length);
+        using BinaryWriter writer = new BinaryWriter(result);
+        writer.Write(Magic);
+        writer.Write(Version);
+        writer.Write((ushort) 0);
+        writer.Write(StableHash.Compute(payloadBytes));
+        writer.Write(payloadBytes);
+        writer.Flush();
+
+        return result.ToArray();
+    }
+
+    private int InternString(string value)
+    {
+        if (!_stringIndices.TryGetValue(value, out int index))
+        {
+            index = _strings.Count;
+            _strings.Add(value);
+            _stringIndices.Add(value, index);
+        }
+
+        return index;
+    }
+
+    private static NotSupportedException Unsupported(string what)
+    {
+        return new NotSupportedException($"{nameof(BinaryJsonWriter)} doesn't support {what}");
+    }
+
+    private void WriteToken(Token token)
+    {
+        _tokens.WriteByte((byte) token);
+    }
+
+    private void WriteInt(long value)
+    {
+        WriteToken(Token.Int);
+        WriteVarUInt((ulong) ((value << 1) ^ (value >> 63)));
+    }
+
+    private void WriteVarUInt(ulong value)
+    {
+        WriteVarUInt(_tokens, value);
+    }
+
+    private static void WriteVarUInt(Stream stream, ulong value)
+    {
+        while (value >= 0x80)
+        {
+            stream.WriteByte((byte) (value | 0x80));
+            value >>= 7;
+        }
+
+        stream.WriteByte((byte) value);
+    }
+}
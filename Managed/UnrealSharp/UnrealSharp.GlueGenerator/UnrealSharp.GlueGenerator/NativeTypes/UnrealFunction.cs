@@ -34,6 +34,7 @@ public record UnrealFunction : UnrealFunctionBase
     {
         ExportBackingVariables(builder);
         ExportInvokeMethod(builder);
+        ExportUnmanagedInvokeMethod(builder);
 
         if (NeedsImplementationFunction)
         {
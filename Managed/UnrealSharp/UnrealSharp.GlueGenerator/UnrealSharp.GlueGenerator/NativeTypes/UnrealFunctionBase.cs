@@ -298,6 +298,26 @@ public abstract record UnrealFunctionBase : UnrealStruct
         builder.CloseBrace();
     }
 
+    // Native calls this directly instead of going through the generic InvokeManagedMethod dispatcher.
+    public void ExportUnmanagedInvokeMethod(GeneratorStringBuilder builder)
+    {
+        builder.AppendLine();
+        builder.AppendEditorBrowsableAttribute();
+        builder.AppendLine("[System.Runtime.InteropServices.UnmanagedCallersOnly]");
+        builder.AppendLine($"static int InvokeUnmanaged_{SourceName}(IntPtr managedObjectHandle, IntPtr buffer, IntPtr returnBuffer, IntPtr exceptionTextBuffer)");
+        builder.OpenBrace();
+        builder.AppendLine("try");
+        builder.OpenBrace();
+        builder.AppendLine($"GCHandleUtilities.GetObjectFromHandlePtrFast<{Outer!.SourceName}>(managedObjectHandle)!.Invoke_{SourceName}(buffer, returnBuffer);");
+        builder.AppendLine("return 0;");
+        builder.CloseBrace();
+        builder.AppendLine("catch (Exception ex)");
+        builder.OpenBrace();
+        builder.AppendLine("return UnmanagedCallbacks.HandleInvokeException(ex, exceptionTextBuffer);");
+        builder.CloseBrace();
+        builder.CloseBrace();
+    }
+
     protected virtual void ExportInvokeMethodCallSignature(GeneratorStringBuilder builder)
     {
         string returnAssignment = HasReturnValue ? $"{ReturnType.ManagedType} returnValue = " : string.Empty;
@@ -35,6 +35,10 @@ public record UnrealType
     public EquatableList<FieldName> SourceGeneratorDependencies;
     public EquatableList<MetaDataInfo> MetaData;
     
+    // Hash of the parameterless constructor's tokens. Passed separately from the reflection data
+    // so the engine can tell default value changes apart from structural ones.
+    public ulong ConstructorHash;
+    
     public UnrealType(UnrealType? outer = null)
     {
         Outer = outer;
@@ -57,6 +61,35 @@ public record UnrealType
         {
             MetaData = new EquatableList<MetaDataInfo>(metaData);
         }
+
+        if (memberSymbol is INamedTypeSymbol typeSymbol)
+        {
+            ConstructorHash = ComputeConstructorHash(typeSymbol);
+        }
+    }
+    
+    private static ulong ComputeConstructorHash(INamedTypeSymbol typeSymbol)
+    {
+        foreach (IMethodSymbol constructor in typeSymbol.InstanceConstructors)
+        {
+            if (constructor.IsImplicitlyDeclared || constructor.Parameters.Length != 0)
+            {
+                continue;
+            }
+
+            ulong hash = StableHash.Compute(string.Empty);
+            foreach (SyntaxReference syntaxReference in constructor.DeclaringSyntaxReferences)
+            {
+                foreach (SyntaxToken token in syntaxReference.GetSyntax().DescendantTokens())
+                {
+                    hash = StableHash.Compute(token.Text, hash);
+                }
+            }
+
+            return hash;
+        }
+
+        return 0;
     }
 
     public UnrealType(string sourceName, string typeNameSpace, Accessibility accessibility, string assemblyName, UnrealType? outer = null) : this(outer)
@@ -159,7 +192,8 @@ public record UnrealType
         return SourceName == other.SourceName && 
                MetaData.Equals(other.MetaData) && 
                Namespace == other.Namespace && 
-               TypeAccessibility == other.TypeAccessibility;
+               TypeAccessibility == other.TypeAccessibility &&
+               ConstructorHash == other.ConstructorHash;
     }
 
     public override int GetHashCode()
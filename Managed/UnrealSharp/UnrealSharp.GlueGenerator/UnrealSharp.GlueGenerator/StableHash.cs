@@ -0,0 +1,32 @@
+namespace UnrealSharp.GlueGenerator;
+
+// FNV-1a. Unlike string.GetHashCode and HashCode, the result is stable across compilations,
+// so it can be compared against hashes the engine stored from a previous build.
+public static class StableHash
+{
+    private const ulong OffsetBasis = 14695981039346656037;
+    private const ulong Prime = 1099511628211;
+
+    public static ulong Compute(byte[] data)
+    {
+        ulong hash = OffsetBasis;
+        foreach (byte b in data)
+        {
+            hash ^= b;
+            hash *= Prime;
+        }
+
+        return hash;
+    }
+
+    public static ulong Compute(string value, ulong hash = OffsetBasis)
+    {
+        foreach (char c in value)
+        {
+            hash ^= c;
+            hash *= Prime;
+        }
+
+        return hash;
+    }
+}
@@ -63,14 +63,26 @@ public static class StringBuilderExtensions
         type.PopulateJsonObject(jsonWriter);
         jsonWriter.WriteEndObject();
         
+        using BinaryJsonWriter binaryWriter = new BinaryJsonWriter();
+        binaryWriter.WriteStartObject();
+        type.PopulateJsonObject(binaryWriter);
+        binaryWriter.WriteEndObject();
+        
         string registrarClassName = $"{type.SourceName}_Registration";
         string jsonPropertyName = $"ReflectionMetadata_{type.SourceName}";
-        string registrationMethodName = $"Register_{type.SourceName}";
+        string binaryPropertyName = $"ReflectionData_{type.SourceName}";
+        string registrationMethodName = "Register";
 
-        builder.StartModuleInitializer(registrarClassName);
+        builder.StartRegistrar(registrarClassName);
         
-        builder.AppendLine($"public static void {registrationMethodName}() => " + $"RegisterManagedType(\"{type.EngineName}\", {jsonPropertyName}, {(byte)type.FieldType}, typeof({type.FullName}));");
+        // JSON is kept as a readable fallback for debugging, opted into by defining UNREALSHARP_JSON_REFLECTION_DATA.
+        builder.BeginPreproccesorBlock("UNREALSHARP_JSON_REFLECTION_DATA");
+        builder.AppendLine($"public static void {registrationMethodName}() => " + $"RegisterManagedType(\"{type.EngineName}\", {jsonPropertyName}, {type.ConstructorHash}UL, {(byte)type.FieldType}, typeof({type.FullName}));");
         builder.AppendLine($"static string {jsonPropertyName} => \"\"\"{stringBuilder}\"\"\";");
+        builder.ElsePreproccesor();
+        builder.AppendLine($"public static void {registrationMethodName}() => " + $"RegisterManagedType(\"{type.EngineName}\", {binaryPropertyName}, {type.ConstructorHash}UL, {(byte)type.FieldType}, typeof({type.FullName}));");
+        builder.AppendLine($"static System.ReadOnlySpan<byte> {binaryPropertyName} => new byte[] {{ {string.Join(", ", binaryWriter.ToArray())} }};");
+        builder.EndPreproccesorBlock();
 
         builder.CloseBrace();
     }
@@ -93,14 +105,14 @@ public static class StringBuilderExtensions
         builder.AppendLine();
     }
 
-    public static void StartModuleInitializer(this GeneratorStringBuilder builder, string initializerName)
+    // Registrars are called explicitly by the plugin loader when the assembly is preloaded, see Plugin.RunGeneratedRegistrars.
+    // They aren't module initializers, since those run wherever the module constructor does, which must be the game thread.
+    public static void StartRegistrar(this GeneratorStringBuilder builder, string registrarName)
     {
         builder.AppendLine();
-        builder.AppendLine($"file static class {initializerName}");
+        builder.AppendLine("[UnrealSharp.Core.Attributes.GeneratedRegistrar]");
+        builder.AppendLine($"file static class {registrarName}");
         builder.OpenBrace();
-        builder.AppendLine("#pragma warning disable CA2255");
-        builder.AppendLine("[System.Runtime.CompilerServices.ModuleInitializer]");
-        builder.AppendLine("#pragma warning restore CA2255");
     }
     
     public static void AllocateParameterBuffer(this GeneratorStringBuilder builder, string sizeName)
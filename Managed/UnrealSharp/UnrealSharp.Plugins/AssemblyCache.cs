@@ -19,25 +19,40 @@ public static class AssemblyCache
 		AddAssembly(typeof(CustomLog).Assembly);
 	}
     
+	// Plugins without references between them are loaded in parallel, so every access is locked.
 	public static void AddAssembly(Assembly assembly)
 	{
 		string assemblyName = assembly.GetName().Name!;
 		
-		if (!LoadedAssemblies.TryGetValue(assemblyName, out List<WeakReference<Assembly>>? assemblies))
+		lock (LoadedAssemblies)
 		{
-			assemblies = new List<WeakReference<Assembly>>();
-			LoadedAssemblies[assemblyName] = assemblies;
+			if (!LoadedAssemblies.TryGetValue(assemblyName, out List<WeakReference<Assembly>>? assemblies))
+			{
+				assemblies = new List<WeakReference<Assembly>>();
+				LoadedAssemblies[assemblyName] = assemblies;
+			}
+			
+			assemblies.Add(new WeakReference<Assembly>(assembly));
 		}
-		
-		assemblies.Add(new WeakReference<Assembly>(assembly));
 	}
 	
 	public static void RemoveAssembly(string assemblyName)
 	{
-		LoadedAssemblies.Remove(assemblyName);
+		lock (LoadedAssemblies)
+		{
+			LoadedAssemblies.Remove(assemblyName);
+		}
 	}
 	
 	public static Assembly? GetUniqueAssembly(string assemblyName)
+	{
+		lock (LoadedAssemblies)
+		{
+			return GetUniqueAssemblyLocked(assemblyName);
+		}
+	}
+	
+	private static Assembly? GetUniqueAssemblyLocked(string assemblyName)
 	{
 		if (!LoadedAssemblies.TryGetValue(assemblyName, out List<WeakReference<Assembly>>? assemblies))
 		{
@@ -59,6 +74,14 @@ public static class AssemblyCache
 	}
 	
 	public static Assembly? GetAssembly(string assemblyName, AssemblyLoadContext loadContext)
+	{
+		lock (LoadedAssemblies)
+		{
+			return GetAssemblyLocked(assemblyName, loadContext);
+		}
+	}
+	
+	private static Assembly? GetAssemblyLocked(string assemblyName, AssemblyLoadContext loadContext)
 	{
 		if (!LoadedAssemblies.TryGetValue(assemblyName, out List<WeakReference<Assembly>>? assemblies))
 		{
@@ -2,6 +2,7 @@
 using System.Runtime.CompilerServices;
 using System.Runtime.Loader;
 using UnrealSharp.Core;
+using UnrealSharp.Core.Attributes;
 using UnrealSharp.Engine.Core.Modules;
 
 namespace UnrealSharp.Plugins;
@@ -10,6 +11,7 @@ public class Plugin
 {
     public readonly AssemblyName AssemblyName;
     public WeakReference? Assembly { get; private set; }
+    public bool IsStarted { get; private set; }
     
     private AssemblyLoadContext? _loadContext;
 
@@ -58,12 +60,25 @@ public class Plugin
         Assembly assembly = _loadContext.LoadFromAssemblyName(AssemblyName);
         Assembly = new WeakReference(assembly);
         
-        RuntimeHelpers.RunModuleConstructor(assembly.ManifestModule.ModuleHandle);
-        
-        StartupModule();
+        RunGeneratedRegistrars(assembly);
         return true;
     }
     
+    // Registers the assembly's types and modules. Unlike the module constructor, these are safe to run off the game thread.
+    private static void RunGeneratedRegistrars(Assembly assembly)
+    {
+        foreach (Type type in assembly.GetTypes())
+        {
+            if (!type.IsDefined(typeof(GeneratedRegistrarAttribute), false))
+            {
+                continue;
+            }
+            
+            MethodInfo registerMethod = type.GetMethod(GeneratedRegistrarAttribute.RegisterMethodName, BindingFlags.Public | BindingFlags.Static)!;
+            registerMethod.Invoke(null, null);
+        }
+    }
+    
     public T GetModule<T>() where T : class, IModuleInterface
     {
         T? module = _moduleInterfaces.OfType<T>().FirstOrDefault();
@@ -94,6 +109,17 @@ public class Plugin
 
     public void StartupModule()
     {
+        if (IsStarted)
+        {
+            return;
+        }
+        
+        IsStarted = true;
+        
+        // Runs the assembly's own [ModuleInitializer]s, which may touch UObjects, so this stays on the game thread.
+        Assembly assembly = (Assembly) Assembly!.Target!;
+        RuntimeHelpers.RunModuleConstructor(assembly.ManifestModule.ModuleHandle);
+        
         _moduleInterfaces.Capacity = _moduleInitFunctions.Count;
         
         foreach (Func<IModuleInterface> moduleInterfaceInitFunc in _moduleInitFunctions)
@@ -115,6 +141,7 @@ public class Plugin
 
         _moduleInterfaces.Clear();
         _moduleInitFunctions.Clear();
+        IsStarted = false;
     }
 
     public override string ToString()
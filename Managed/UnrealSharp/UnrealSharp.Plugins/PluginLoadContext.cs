@@ -1,3 +1,4 @@
+using System.Collections.Concurrent;
 using System.Reflection;
 using System.Runtime.Loader;
 using System.IO;
@@ -7,6 +8,10 @@ namespace UnrealSharp.Plugins;
 public class PluginLoadContext : AssemblyLoadContext
 {
     private readonly AssemblyDependencyResolver _resolver;
+    
+    // Plugins are loaded in parallel, so two of them may resolve the same dependency at once. Only the first loads it,
+    // the other one picks it up from the AssemblyCache.
+    private static readonly ConcurrentDictionary<string, object> DependencyLocks = new();
 
     public PluginLoadContext(string pluginName, AssemblyDependencyResolver resolver, bool isCollectible) : base(pluginName, isCollectible)
     {
@@ -20,6 +25,14 @@ public class PluginLoadContext : AssemblyLoadContext
             return null;
         }
         
+        lock (DependencyLocks.GetOrAdd(assemblyName.Name!, _ => new object()))
+        {
+            return LoadDependency(assemblyName);
+        }
+    }
+    
+    private Assembly? LoadDependency(AssemblyName assemblyName)
+    {
         Assembly? loadedAssembly = AssemblyCache.GetAssembly(assemblyName.Name!, this);
         if (loadedAssembly != null)
         {
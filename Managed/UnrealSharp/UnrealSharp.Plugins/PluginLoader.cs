@@ -10,27 +10,50 @@ public static class PluginLoader
 	private static readonly Dictionary<string, Plugin> Plugins = [];
 
 	public static Assembly? LoadPlugin(string assemblyPath, bool isCollectible)
+	{
+		Plugin? plugin = PreloadPlugin(assemblyPath, isCollectible);
+
+		if (plugin == null)
+		{
+			return null;
+		}
+
+		plugin.StartupModule();
+		return (Assembly)plugin.Assembly!.Target!;
+	}
+
+	// Loads the assembly and runs its generated registrars, which register its types with the engine.
+	// Can run on worker threads for assemblies that don't reference each other. Module initializers and modules are run by LoadPlugin.
+	public static Plugin? PreloadPlugin(string assemblyPath, bool isCollectible)
 	{
 		try
 		{
 			AssemblyName assemblyName = new AssemblyName(Path.GetFileNameWithoutExtension(assemblyPath));
+			Plugin plugin;
 
-			if (Plugins.TryGetValue(assemblyName.Name!, out Plugin? loadedPlugin))
+			lock (Plugins)
 			{
-				return (Assembly)loadedPlugin.Assembly!.Target!;
-			}
+				if (Plugins.TryGetValue(assemblyName.Name!, out Plugin? loadedPlugin))
+				{
+					return loadedPlugin;
+				}
 
-			Plugin plugin = new Plugin(assemblyName, isCollectible, assemblyPath);
-			Plugins.Add(assemblyName.Name!, plugin);
+				plugin = new Plugin(assemblyName, isCollectible, assemblyPath);
+				Plugins.Add(assemblyName.Name!, plugin);
+			}
 
 			if (!plugin.Load())
 			{
-				Plugins.Remove(assemblyName.Name!);
+				lock (Plugins)
+				{
+					Plugins.Remove(assemblyName.Name!);
+				}
+				
 				throw new InvalidOperationException($"Failed to load plugin: {assemblyName}");
 			}
 
 			LogUnrealSharpPlugins.Log($"Successfully loaded plugin: '{assemblyName}' at '{assemblyPath}'");
-			return (Assembly)plugin.Assembly!.Target!;
+			return plugin;
 		}
 		catch (Exception ex)
 		{
@@ -43,9 +66,13 @@ public static class PluginLoader
 	[MethodImpl(MethodImplOptions.NoInlining)]
 	private static WeakReference? RemovePlugin(string assemblyName)
 	{
-		if (!Plugins.Remove(assemblyName, out Plugin? plugin))
+		Plugin? plugin;
+		lock (Plugins)
 		{
-			return null;
+			if (!Plugins.Remove(assemblyName, out plugin))
+			{
+				return null;
+			}
 		}
 
 		return plugin.Unload();
@@ -119,7 +146,10 @@ public static class PluginLoader
 
 	public static Plugin? FindPlugin(string assemblyName)
 	{
-		return Plugins.GetValueOrDefault(assemblyName);
+		lock (Plugins)
+		{
+			return Plugins.GetValueOrDefault(assemblyName);
+		}
 	}
 
 	public static T FindModule<T>() where T : class, IModuleInterface
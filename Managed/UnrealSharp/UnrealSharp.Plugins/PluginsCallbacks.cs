@@ -10,6 +10,7 @@ public unsafe struct PluginsCallbacks
 {
     public delegate* unmanaged<char*, NativeBool, IntPtr> LoadPlugin;
     public delegate* unmanaged<char*, void> UnloadPlugin;
+    public delegate* unmanaged<char*, NativeBool, NativeBool> PreloadPlugin;
     
     [UnmanagedCallersOnly]
     private static nint ManagedLoadPlugin(char* assemblyPath, NativeBool isCollectible)
@@ -24,6 +25,13 @@ public unsafe struct PluginsCallbacks
         return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(newPlugin, newPlugin));
     }
 
+    [UnmanagedCallersOnly]
+    private static NativeBool ManagedPreloadPlugin(char* assemblyPath, NativeBool isCollectible)
+    {
+        Plugin? plugin = PluginLoader.PreloadPlugin(new string(assemblyPath), isCollectible.ToManagedBool());
+        return (plugin != null).ToNativeBool();
+    }
+
     [UnmanagedCallersOnly]
     private static void ManagedUnloadPlugin(char* assemblyPath)
     {
@@ -36,6 +44,7 @@ public unsafe struct PluginsCallbacks
         {
             LoadPlugin = &ManagedLoadPlugin,
             UnloadPlugin = &ManagedUnloadPlugin,
+            PreloadPlugin = &ManagedPreloadPlugin,
         };
     }
 }
\ No newline at end of file
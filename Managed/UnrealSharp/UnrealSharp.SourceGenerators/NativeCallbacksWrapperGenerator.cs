@@ -131,9 +131,20 @@ public class NativeCallbacksWrapperGenerator : IIncrementalGenerator
 
                 sourceBuilder.AppendLine(";");
             }
+        }
+
+        // Resolve every bound function of this class in a single native call.
+        string functionNames = string.Join(", ", classInfo.Delegates.Select(d => "\"" + d.Name + "\""));
+        string functionSizes = string.Join(", ", classInfo.Delegates.Select(d => d.Name + "TotalSize"));
+        sourceBuilder.AppendLine($"             string[] functionNames = new string[] {{ {functionNames} }};");
+        sourceBuilder.AppendLine($"             int[] functionSizes = new int[] {{ {functionSizes} }};");
+        sourceBuilder.AppendLine($"             IntPtr[] functionPtrs = UnrealSharp.Binds.NativeBinds.TryGetBoundFunctions(\"{classInfo.Name}\", functionNames, functionSizes);");
+
+        for (int delegateIndex = 0; delegateIndex < classInfo.Delegates.Count; delegateIndex++)
+        {
+            DelegateInfo delegateInfo = classInfo.Delegates[delegateIndex];
+            string delegateName = delegateInfo.Name;
 
-            string funcPtrName = delegateName + "FuncPtr";
-            sourceBuilder.AppendLine($"             IntPtr {funcPtrName} = UnrealSharp.Binds.NativeBinds.TryGetBoundFunction(\"{classInfo.Name}\", \"{delegateInfo.Name}\", {totalSizeDelegateName});");
             sourceBuilder.Append($"             {delegateName} = (delegate* unmanaged<");
             sourceBuilder.Append(string.Join(", ", delegateInfo.Parameters.Select(p =>
             {
@@ -148,7 +159,7 @@ public class NativeCallbacksWrapperGenerator : IIncrementalGenerator
             
             sourceBuilder.Append(delegateInfo.ReturnValue.Type.GetAnnotatedTypeName(model) ?? delegateInfo.ReturnValue.Type.ToString());
 
-            sourceBuilder.Append($">){funcPtrName};");
+            sourceBuilder.Append($">)functionPtrs[{delegateIndex}];");
             sourceBuilder.AppendLine();
         }
 
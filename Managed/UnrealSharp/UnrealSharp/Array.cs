@@ -1,6 +1,9 @@
-﻿using UnrealSharp.Attributes;
+﻿using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Attributes;
 using UnrealSharp.Core;
 using UnrealSharp.Core.Attributes;
+using UnrealSharp.Core.Interop;
 using UnrealSharp.Core.Marshallers;
 using UnrealSharp.Interop;
 
@@ -71,6 +74,104 @@ public class TArray<T> : UnrealArrayBase<T>, IList<T>, IReadOnlyList<T>
         BroadcastChanged();
     }
 
+    /// <summary>
+    /// Adds a range of elements to the end of the array.
+    /// Blittable elements are copied in a single native call.
+    /// </summary>
+    /// <param name="items"> The elements to add. </param>
+    public void AddRange(ReadOnlySpan<T> items)
+    {
+        if (items.IsEmpty)
+        {
+            return;
+        }
+
+        if (IsBlittable)
+        {
+            unsafe
+            {
+                fixed (byte* source = &Unsafe.As<T, byte>(ref MemoryMarshal.GetReference(items)))
+                {
+                    Bind_FScriptArray.CallAppend(NativeBuffer, NativeProperty, (IntPtr) source, items.Length);
+                }
+            }
+        }
+        else
+        {
+            int startIndex = Count;
+            InsertRangeInternal(startIndex, items.Length);
+            CopyRangeToNative(startIndex, items);
+        }
+
+        BroadcastChanged();
+    }
+
+    /// <summary>
+    /// Inserts a range of elements into the array at the specified index.
+    /// </summary>
+    /// <param name="index"> The index to insert the elements at. </param>
+    /// <param name="items"> The elements to insert. </param>
+    public void InsertRange(int index, ReadOnlySpan<T> items)
+    {
+        if (index < 0 || index > Count)
+        {
+            throw new IndexOutOfRangeException($"Index {index} is out of bounds. Array size is {Count}.");
+        }
+
+        if (items.IsEmpty)
+        {
+            return;
+        }
+
+        InsertRangeInternal(index, items.Length);
+        CopyRangeToNative(index, items);
+        BroadcastChanged();
+    }
+
+    /// <summary>
+    /// Removes a range of elements from the array.
+    /// </summary>
+    /// <param name="index"> The index of the first element to remove. </param>
+    /// <param name="count"> The number of elements to remove. </param>
+    public void RemoveRange(int index, int count)
+    {
+        if (index < 0 || count < 0 || index + count > Count)
+        {
+            throw new IndexOutOfRangeException($"Range {index}..{index + count} is out of bounds. Array size is {Count}.");
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        RemoveRangeInternal(index, count);
+        BroadcastChanged();
+    }
+
+    /// <summary>
+    /// Makes sure the array can hold at least the specified number of elements without reallocating.
+    /// </summary>
+    /// <param name="capacity"> The number of elements to reserve space for. </param>
+    public void Reserve(int capacity)
+    {
+        unsafe
+        {
+            Bind_FScriptArray.CallReserve(NativeBuffer, NativeProperty, capacity);
+        }
+    }
+
+    /// <summary>
+    /// Releases any slack the array has allocated beyond its current size.
+    /// </summary>
+    public void Shrink()
+    {
+        unsafe
+        {
+            Bind_FScriptArray.CallShrink(NativeBuffer, NativeProperty);
+        }
+    }
+
     /// <summary>
     /// Removes all elements from the array.
     /// </summary>
@@ -183,6 +284,7 @@ public class TArray<T> : UnrealArrayBase<T>, IList<T>, IReadOnlyList<T>
 public class ArrayMarshaller<T>(IntPtr nativeProperty, MarshallingDelegates<T>.ToNative toNative, MarshallingDelegates<T>.FromNative fromNative)
 {
     private TArray<T>? _arrayWrapper;
+    private readonly bool _isBlittable = UnrealArrayBase<T>.IsBlittableMarshaller(toNative);
 
     public void ToNative(IntPtr nativeBuffer, int arrayIndex, IList<T> obj)
     {
@@ -191,9 +293,28 @@ public class ArrayMarshaller<T>(IntPtr nativeProperty, MarshallingDelegates<T>.T
 
     public void ToNative(IntPtr nativeBuffer, IList<T> obj)
     {
+        if (typeof(T) == typeof(string))
+        {
+            StringMarshaller.ToNativeArray(nativeBuffer, (IList<string>) obj);
+            return;
+        }
+        
         unsafe
         {
             UnmanagedArray* mirror = (UnmanagedArray*)nativeBuffer;
+
+            if (_isBlittable && TryGetSpan(obj, out ReadOnlySpan<T> span))
+            {
+                Bind_FScriptArray.CallSetNumUninitialized(mirror, nativeProperty, span.Length);
+
+                if (!span.IsEmpty)
+                {
+                    ref byte source = ref Unsafe.As<T, byte>(ref MemoryMarshal.GetReference(span));
+                    Unsafe.CopyBlockUnaligned(ref Unsafe.AsRef<byte>((void*) mirror->Data), ref source, (uint) (span.Length * Unsafe.SizeOf<T>()));
+                }
+                return;
+            }
+
             if (mirror->ArrayNum == obj.Count)
             {
                 for (int i = 0; i < obj.Count; ++i)
@@ -212,6 +333,22 @@ public class ArrayMarshaller<T>(IntPtr nativeProperty, MarshallingDelegates<T>.T
         }
     }
 
+    private static bool TryGetSpan(IList<T> list, out ReadOnlySpan<T> span)
+    {
+        switch (list)
+        {
+            case T[] array:
+                span = array;
+                return true;
+            case List<T> managedList:
+                span = CollectionsMarshal.AsSpan(managedList);
+                return true;
+            default:
+                span = default;
+                return false;
+        }
+    }
+
     public virtual TArray<T> FromNative(IntPtr nativeBuffer, int arrayIndex)
     {
         if (_arrayWrapper == null)
@@ -170,6 +170,53 @@ public partial class UObject
         return GCHandleUtilities.GetObjectFromHandlePtr<T>(handle)!;
     }
 
+    /// <summary>
+    /// Creates several new objects of the specified type in a single call into native code.
+    /// </summary>
+    /// <param name="count"> The number of objects to create. </param>
+    /// <param name="outer"> The outer object. </param>
+    /// <param name="classType"> The type of the objects to create. </param>
+    /// <param name="template"> The template object to use. All the property values from this template will be copied. </param>
+    /// <typeparam name="T"> The type of the objects to create. </typeparam>
+    /// <returns> The newly created objects. </returns>
+    public static unsafe T[] NewObjects<T>(int count, UObject? outer = null, TSubclassOf<T> classType = default, UObject? template = null) where T : UObject
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(count);
+
+        if (count == 0)
+        {
+            return Array.Empty<T>();
+        }
+
+        if (classType.NativeClass == IntPtr.Zero)
+        {
+            classType = new TSubclassOf<T>(typeof(T));
+        }
+
+        IntPtr nativeTemplate = template?.NativeObject ?? IntPtr.Zero;
+
+        if (outer == null || outer.NativeObject == IntPtr.Zero)
+        {
+            outer = GetTransientPackage();
+        }
+
+        IntPtr[] handles = GC.AllocateUninitializedArray<IntPtr>(count);
+        int created;
+
+        fixed (IntPtr* handlesPtr = handles)
+        {
+            created = Bind_UObject.CallCreateNewObjects(outer.NativeObject, classType.NativeClass, nativeTemplate, count, handlesPtr);
+        }
+
+        T[] objects = new T[created];
+        for (int i = 0; i < created; i++)
+        {
+            objects[i] = GCHandleUtilities.GetObjectFromHandlePtr<T>(handles[i])!;
+        }
+
+        return objects;
+    }
+
     /// <summary>
     /// Gets the transient package.
     /// </summary>
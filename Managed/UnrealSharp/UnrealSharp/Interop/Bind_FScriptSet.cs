@@ -13,7 +13,8 @@ public static unsafe partial class Bind_FScriptSet
     public static delegate* unmanaged<int, IntPtr, IntPtr, void> Empty;
     public static delegate* unmanaged<int, IntPtr, IntPtr, void> RemoveAt;
     public static delegate* unmanaged<IntPtr, IntPtr, int> AddUninitialized;
-    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, HashDelegates.GetKeyHash, HashDelegates.Equality, int> FindIndex;
-    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, HashDelegates.GetKeyHash, HashDelegates.Equality, HashDelegates.Construct, HashDelegates.Destruct, void> Add;
-    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, HashDelegates.GetKeyHash, HashDelegates.Equality, HashDelegates.Construct, int> FindOrAdd;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int> FindIndex;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> Add;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int> FindOrAdd;
+    public static delegate* unmanaged<IntPtr, IntPtr, SparseEnumerationSnapshot*, uint*, int, int> GetEnumerationSnapshot;
 }
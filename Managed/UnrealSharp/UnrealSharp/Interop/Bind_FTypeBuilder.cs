@@ -7,9 +7,10 @@ namespace UnrealSharp.Interop;
 [NativeCallbacks]
 public static unsafe partial class Bind_FTypeBuilder
 {
-    public static delegate* unmanaged<char*, char*, char*, char*, byte, IntPtr, void> RegisterManagedType_Native;
+    public static delegate* unmanaged<char*, char*, char*, char*, ulong, byte, IntPtr, void> RegisterManagedType_Native;
+    public static delegate* unmanaged<char*, char*, char*, byte*, int, ulong, byte, IntPtr, void> RegisterManagedTypeFromBinary_Native;
     
-    public static void RegisterManagedType(string typeName, string jsonString, byte fieldType, Type type)
+    public static void RegisterManagedType(string typeName, string jsonString, ulong constructorHash, byte fieldType, Type type)
     {
         IntPtr handlePtr = GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, type.Assembly));
         
@@ -18,7 +19,20 @@ public static unsafe partial class Bind_FTypeBuilder
         fixed (char* nAssemblyName = type.Assembly.GetName().Name)
         fixed (char* nJson = jsonString)
         {
-            RegisterManagedType_Native(nTypeName, nNamespace, nAssemblyName, nJson, fieldType, handlePtr);
+            RegisterManagedType_Native(nTypeName, nNamespace, nAssemblyName, nJson, constructorHash, fieldType, handlePtr);
         }
     }
-}
+    
+    public static void RegisterManagedType(string typeName, ReadOnlySpan<byte> reflectionData, ulong constructorHash, byte fieldType, Type type)
+    {
+        IntPtr handlePtr = GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, type.Assembly));
+        
+        fixed (char* nTypeName = typeName)
+        fixed (char* nNamespace = type.Namespace)
+        fixed (char* nAssemblyName = type.Assembly.GetName().Name)
+        fixed (byte* nReflectionData = reflectionData)
+        {
+            RegisterManagedTypeFromBinary_Native(nTypeName, nNamespace, nAssemblyName, nReflectionData, reflectionData.Length, constructorHash, fieldType, handlePtr);
+        }
+    }
+}
\ No newline at end of file
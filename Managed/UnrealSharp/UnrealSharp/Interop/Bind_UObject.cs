@@ -7,6 +7,7 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class Bind_UObject
 {
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr> CreateNewObject;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, int, IntPtr*, int> CreateNewObjects;
     public static delegate* unmanaged<IntPtr> GetTransientPackage;
     public static delegate* unmanaged<IntPtr, out FName, void> NativeGetName;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, IntPtr, void> InvokeNativeFunction;
@@ -16,4 +16,5 @@ public static unsafe partial class Bind_FScriptMapHelper
     public static delegate* unmanaged<IntPtr, IntPtr, int, NativeBool> IsValidIndex;
     public static delegate* unmanaged<IntPtr, IntPtr, int> GetMaxIndex;
     public static delegate* unmanaged<IntPtr, IntPtr, int, IntPtr> GetPairPtr;
+    public static delegate* unmanaged<IntPtr, IntPtr, SparseEnumerationSnapshot*, uint*, int, int> GetEnumerationSnapshot;
 }
\ No newline at end of file
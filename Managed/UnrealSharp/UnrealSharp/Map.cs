@@ -61,14 +61,11 @@ public class TMap<TKey, TValue> : MapBase<TKey, TValue>, IDictionary<TKey, TValu
     /// <inheritdoc />
     public void CopyTo(KeyValuePair<TKey, TValue>[] array, int arrayIndex)
     {
-        int maxIndex = GetMaxIndex();
         int index = arrayIndex;
-        for (int i = 0; i < maxIndex; ++i)
+        SparseEnumerator pairs = EnumeratePairs();
+        while (pairs.MoveNext())
         {
-            if (IsValidIndex(i))
-            {
-                array[index++] = GetAt(i);
-            }
+            array[index++] = new KeyValuePair<TKey, TValue>(KeyFromNative(pairs.KeyPtr), ValueFromNative(pairs.ValuePtr));
         }
     }
 
@@ -68,6 +68,24 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
         return _helper.GetPairPtr(index, out keyPtr, out valuePtr);
     }
 
+    /// <summary>
+    /// Walks the pairs directly in native memory. Modifying the map while enumerating makes MoveNext throw.
+    /// </summary>
+    internal SparseEnumerator EnumeratePairs()
+    {
+        return _helper.EnumeratePairs();
+    }
+
+    internal TKey KeyFromNative(IntPtr keyPtr)
+    {
+        return _keyFromNative(keyPtr, 0);
+    }
+
+    internal TValue ValueFromNative(IntPtr valuePtr)
+    {
+        return _valueFromNative(valuePtr, 0);
+    }
+
     protected void ClearInternal()
     {
         _helper.EmptyValues();
@@ -150,10 +168,10 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
     public bool ContainsValue(TValue value)
     {
         EqualityComparer<TValue> comparer = EqualityComparer<TValue>.Default;
-        int maxIndex = GetMaxIndex();
-        for (int i = 0; i < maxIndex; ++i)
+        SparseEnumerator pairs = EnumeratePairs();
+        while (pairs.MoveNext())
         {
-            if (IsValidIndex(i) && comparer.Equals(GetAt(i).Value, value))
+            if (comparer.Equals(ValueFromNative(pairs.ValuePtr), value))
             {
                 return true;
             }
@@ -198,9 +216,9 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
     /// <inheritdoc />
     public struct Enumerator(MapBase<TKey, TValue> map) : IEnumerator<KeyValuePair<TKey, TValue>>
     {
-        private int index = -1;
+        private SparseEnumerator pairs = map.EnumeratePairs();
 
-        public KeyValuePair<TKey, TValue> Current => map.GetAt(index);
+        public KeyValuePair<TKey, TValue> Current => new(map.KeyFromNative(pairs.KeyPtr), map.ValueFromNative(pairs.ValuePtr));
 
         object IEnumerator.Current => Current;
 
@@ -212,15 +230,13 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
         /// <inheritdoc />
         public bool MoveNext()
         {
-            int maxIndex = map.GetMaxIndex();
-            while (++index < maxIndex && !map.IsValidIndex(index)) { }
-            return index < maxIndex;
+            return pairs.MoveNext();
         }
 
         /// <inheritdoc />
         public void Reset()
         {
-            index = -1;
+            pairs = map.EnumeratePairs();
         }
     }
 
@@ -254,14 +270,11 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public void CopyTo(TKey[] array, int arrayIndex)
         {
-            int maxIndex = map.GetMaxIndex();
             int index = arrayIndex;
-            for (int i = 0; i < maxIndex; ++i)
+            SparseEnumerator pairs = map.EnumeratePairs();
+            while (pairs.MoveNext())
             {
-                if (map.IsValidIndex(i))
-                {
-                    array[index++] = map.GetAt(i).Key;
-                }
+                array[index++] = map.KeyFromNative(pairs.KeyPtr);
             }
         }
 
@@ -287,7 +300,7 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public struct Enumerator : IEnumerator<TKey>
         {
-            private int index;
+            private SparseEnumerator pairs;
             private MapBase<TKey, TValue> map;
 
             public int Count => map.Count;
@@ -295,10 +308,10 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
             public Enumerator(MapBase<TKey, TValue> map)
             {
                 this.map = map;
-                index = -1;
+                pairs = map.EnumeratePairs();
             }
 
-            public TKey Current => map.GetAt(index).Key;
+            public TKey Current => map.KeyFromNative(pairs.KeyPtr);
             object IEnumerator.Current => Current;
 
             public void Dispose()
@@ -308,14 +321,12 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
             public bool MoveNext()
             {
-                int maxIndex = map.GetMaxIndex();
-                while (++index < maxIndex && !map.IsValidIndex(index)) { }
-                return index < maxIndex;
+                return pairs.MoveNext();
             }
 
             public void Reset()
             {
-                index = -1;
+                pairs = map.EnumeratePairs();
             }
         }
     }
@@ -350,14 +361,11 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public void CopyTo(TValue[] array, int arrayIndex)
         {
-            int maxIndex = map.GetMaxIndex();
             int index = arrayIndex;
-            for (int i = 0; i < maxIndex; ++i)
+            SparseEnumerator pairs = map.EnumeratePairs();
+            while (pairs.MoveNext())
             {
-                if (map.IsValidIndex(i))
-                {
-                    array[index++] = map.GetAt(i).Value;
-                }
+                array[index++] = map.ValueFromNative(pairs.ValuePtr);
             }
         }
 
@@ -383,7 +391,7 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
         public struct Enumerator : IEnumerator<TValue>
         {
-            private int index;
+            private SparseEnumerator pairs;
             private MapBase<TKey, TValue> map;
 
             public int Count => map.Count;
@@ -391,10 +399,10 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
             public Enumerator(MapBase<TKey, TValue> map)
             {
                 this.map = map;
-                index = -1;
+                pairs = map.EnumeratePairs();
             }
 
-            public TValue Current => map.GetAt(index).Value;
+            public TValue Current => map.ValueFromNative(pairs.ValuePtr);
 
             object? IEnumerator.Current => Current;
 
@@ -404,14 +412,12 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
             public bool MoveNext()
             {
-                int maxIndex = map.GetMaxIndex();
-                while (++index < maxIndex && !map.IsValidIndex(index)) { }
-                return index < maxIndex;
+                return pairs.MoveNext();
             }
 
             public void Reset()
             {
-                index = -1;
+                pairs = map.EnumeratePairs();
             }
         }
     }
@@ -537,18 +543,12 @@ public class MapCopyMarshaller<TKey, TValue> where TKey : notnull
     {
         _helper.MapAddress = nativeBuffer;
         
-        Dictionary<TKey, TValue> result = new Dictionary<TKey, TValue>();
-        int maxIndex = _helper.GetMaxIndex();
+        SparseEnumerator pairs = _helper.EnumeratePairs();
+        Dictionary<TKey, TValue> result = new Dictionary<TKey, TValue>(pairs.Num);
         
-        for (int i = 0; i < maxIndex; ++i)
+        while (pairs.MoveNext())
         {
-            if (!_helper.IsValidIndex(i))
-            {
-                continue;
-            }
-                
-            _helper.GetPairPtr(i, out IntPtr keyPtr, out IntPtr valuePtr);
-            result.Add(_keyFromNative(keyPtr, 0), _valueFromNative(valuePtr, 0));
+            result.Add(_keyFromNative(pairs.KeyPtr, 0), _valueFromNative(pairs.ValuePtr, 0));
         }
         
         return result;
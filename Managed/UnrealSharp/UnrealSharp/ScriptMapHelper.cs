@@ -60,6 +60,14 @@ internal unsafe struct ScriptMapHelper
         return Bind_FScriptMapHelper.CallGetMaxIndex(_mapProperty.Property, MapAddress);
     }
 
+    /// <summary>
+    /// Captures the layout and allocated slots of the map in a single native call, to walk its pairs directly in native memory.
+    /// </summary>
+    public SparseEnumerator EnumeratePairs()
+    {
+        return SparseEnumerator.CaptureMap(_mapProperty.Property, MapAddress);
+    }
+
     public bool GetPairPtr(int index, out IntPtr keyPtr, out IntPtr valuePtr)
     {
         IntPtr pairPtr = Bind_FScriptMapHelper.CallGetPairPtr(_mapProperty.Property, MapAddress, index);
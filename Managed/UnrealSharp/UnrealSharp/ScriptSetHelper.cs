@@ -1,32 +1,10 @@
-﻿using System.Runtime.InteropServices;
-using UnrealSharp.Core;
+﻿using UnrealSharp.Core;
 using UnrealSharp.Core.Marshallers;
 using UnrealSharp.Interop;
 using UnrealSharp.Interop.Properties;
 
 namespace UnrealSharp;
 
-public class HashDelegates
-{
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate uint GetKeyHash(IntPtr element);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate NativeBool Equality(IntPtr a, IntPtr b);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate void Construct(IntPtr element);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate void Destruct(IntPtr element);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate void ConstructAndAssign(IntPtr element);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate void Assign(IntPtr element);
-}
-
 internal unsafe struct FScriptSetHelper
 {        
     private readonly NativeProperty _setProperty;
@@ -61,6 +39,14 @@ internal unsafe struct FScriptSetHelper
         return Set.GetMaxIndex();
     }
 
+    /// <summary>
+    /// Captures the layout and allocated slots of the set in a single native call, to walk its elements directly in native memory.
+    /// </summary>
+    internal SparseEnumerator EnumerateElements()
+    {
+        return SparseEnumerator.CaptureSet(Set.SetPointer, _setProperty.Property);
+    }
+
     /// <summary>
     /// Static version of Num() used when you don't need to bother to construct a FScriptSetHelper. Returns the number of elements in the set.
     /// </summary>
@@ -185,19 +171,7 @@ internal unsafe struct FScriptSetHelper
     /// </summary>
     internal int FindElementIndexFromHash(IntPtr elementToFind)
     {
-        NativeProperty nativeProperty = _elementProp;
-
-        uint ElementHash(IntPtr elementKey)
-        {
-            return nativeProperty.GetValueTypeHash(elementKey);
-        }
-
-        NativeBool ElementEquality(IntPtr a, IntPtr b)
-        {
-            return nativeProperty.Identical(a, b).ToNativeBool();
-        }
-
-        return Set.FindIndex(elementToFind, _setProperty.Property, ElementHash, ElementEquality);
+        return Set.FindIndex(elementToFind, _setProperty.Property);
     }
 
     internal int IndexOf<T>(T item, MarshallingDelegates<T>.ToNative toNative)
@@ -243,58 +217,12 @@ internal unsafe struct FScriptSetHelper
     /// </summary>
     internal void AddElement(IntPtr elementToAdd)
     {
-        NativeProperty property = _elementProp;
-
-        uint ElementHash(IntPtr elementKey)
-        {
-            return Bind_FProperty.CallGetValueTypeHash(property.Property, elementKey);
-        }
-
-        NativeBool ElementEquality(IntPtr a, IntPtr b)
-        {
-            return Bind_FProperty.CallIdentical(property.Property, a, b);
-        }
-
-        void ElementConstruct(IntPtr newElement)
-        {
-            property.InitializeValue(newElement);
-            Bind_FProperty.CallCopySingleValue(property.Property, newElement, elementToAdd);
-        }
-
-        void ElementDestruct(IntPtr element)
-        {
-            if (property.HasAnyPropertyFlags(NativePropertyFlags.IsPlainOldData | NativePropertyFlags.NoDestructor))
-            {
-                return;
-            }
-            
-            property.DestroyValue(element);
-        }
-
-        Set.Add(elementToAdd, _setProperty.Property, ElementHash, ElementEquality, ElementConstruct, ElementDestruct);
+        Set.Add(elementToAdd, _setProperty.Property);
     }
     
     internal int FindOrAddElement(IntPtr elementToAdd)
     {
-        NativeProperty property = _elementProp;
-
-        uint ElementHash(IntPtr elementKey)
-        {
-            return Bind_FProperty.CallGetValueTypeHash(property.Property, elementKey);
-        }
-
-        NativeBool ElementEquality(IntPtr a, IntPtr b)
-        {
-            return Bind_FProperty.CallIdentical(property.Property, a, b);
-        }
-
-        void ElementConstruct(IntPtr newElement)
-        {
-            property.InitializeValue(newElement);
-            Bind_FProperty.CallCopySingleValue(property.Property, newElement, elementToAdd);
-        }
-
-        return Set.FindOrAdd(elementToAdd, _setProperty.Property, ElementHash, ElementEquality, ElementConstruct);
+        return Set.FindOrAdd(elementToAdd, _setProperty.Property);
     }
 
     /// <summary>
@@ -302,19 +230,7 @@ internal unsafe struct FScriptSetHelper
     /// </summary>
     internal bool RemoveElement(IntPtr elementToRemove)
     {
-        NativeProperty property = _elementProp;
-
-        uint ElementHash(IntPtr elementKey)
-        {
-            return property.GetValueTypeHash(elementKey);
-        }
-
-        NativeBool ElementEquality(IntPtr a, IntPtr b)
-        {
-            return property.Identical(a, b).ToNativeBool();
-        }
-
-        int foundIndex = Set.FindIndex(elementToRemove, _setProperty.Property, ElementHash, ElementEquality);
+        int foundIndex = Set.FindIndex(elementToRemove, _setProperty.Property);
         
         if (foundIndex == -1)
         {
@@ -32,14 +32,11 @@ public class TSet<T> : TSetBase<T>, ISet<T>, IReadOnlySet<T>
 
     public void CopyTo(T[] array, int arrayIndex)
     {
-        int maxIndex = SetHelper.GetMaxIndex();
         int index = arrayIndex;
-        for (int i = 0; i < maxIndex; ++i)
+        SparseEnumerator elements = EnumerateElements();
+        while (elements.MoveNext())
         {
-            if (SetHelper.IsValidIndex(i))
-            {
-                array[index++] = Get(i);
-            }
+            array[index++] = FromNative(elements.ElementPtr, 0);
         }
     }
 
@@ -313,18 +310,13 @@ public class SetCopyMarshaller<T>
     public HashSet<T> FromNative(IntPtr nativeBuffer, int arrayIndex)
     {
         _helper.Set = new FScriptSet(nativeBuffer);
-        HashSet<T> result = new HashSet<T>();
-            
-        int maxIndex = _helper.Set.GetMaxIndex();
+        
+        SparseEnumerator elements = _helper.EnumerateElements();
+        HashSet<T> result = new HashSet<T>(elements.Num);
             
-        for (int i = 0; i < maxIndex; ++i)
+        while (elements.MoveNext())
         {
-            if (!_helper.Set.IsValidIndex(i))
-            {
-                continue;
-            }
-                
-            result.Add(_elementFromNative(_helper.GetElementPtr(i), 0));
+            result.Add(_elementFromNative(elements.ElementPtr, 0));
         }
         return result;
     }
@@ -45,6 +45,14 @@ public abstract class TSetBase<T> : IEnumerable<T>
         return FromNative(SetHelper.GetElementPtr(index), 0);
     }
 
+    /// <summary>
+    /// Walks the elements directly in native memory. Modifying the set while enumerating makes MoveNext throw.
+    /// </summary>
+    internal SparseEnumerator EnumerateElements()
+    {
+        return SetHelper.EnumerateElements();
+    }
+
     public int IndexOf(T item)
     {
         return SetHelper.IndexOf(item, ToNative);
@@ -305,9 +313,9 @@ public abstract class TSetBase<T> : IEnumerable<T>
 
     public struct Enumerator(TSetBase<T> set) : IEnumerator<T>
     {
-        private int _index = -1;
+        private SparseEnumerator _elements = set.EnumerateElements();
 
-        public T Current => set.Get(_index);
+        public T Current => set.FromNative(_elements.ElementPtr, 0);
 
         object? IEnumerator.Current => Current;
 
@@ -317,19 +325,12 @@ public abstract class TSetBase<T> : IEnumerable<T>
 
         public bool MoveNext()
         {
-            int maxIndex = set.SetHelper.GetMaxIndex();
-            
-            while (++_index < maxIndex && !set.SetHelper.IsValidIndex(_index))
-            {
-                
-            }
-            
-            return _index < maxIndex;
+            return _elements.MoveNext();
         }
 
         public void Reset()
         {
-            _index = -1;
+            _elements = set.EnumerateElements();
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+﻿using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// The layout of a native TMap or TSet, as returned by GetEnumerationSnapshot.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct SparseEnumerationSnapshot
+{
+    public IntPtr Data;
+    public int MaxIndex;
+    public int Num;
+    public int Stride;
+    public int KeyOffset;
+    public int ValueOffset;
+}
+
+/// <summary>
+/// Walks the elements of a native TMap or TSet directly in native memory.
+/// The layout and allocation flags are captured in a single native call. Modifying the container afterwards makes MoveNext throw.
+/// </summary>
+internal unsafe struct SparseEnumerator
+{
+    // Containers with up to 256 slots keep their allocation flags inline, so enumerating them doesn't allocate.
+    private const int InlineFlagWords = 8;
+
+    /// <summary>
+    /// Mirrors the FScriptSparseArray every TSet and TMap starts with. Checked against the native layout in CSSparseEnumerationSnapshot.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    private struct ScriptSparseArray
+    {
+        public IntPtr Data;
+        public int MaxIndex;
+        public int ArrayMax;
+        
+        // FScriptBitArray, with the four inline words of FDefaultBitArrayAllocator.
+        public fixed uint InlineAllocationFlags[4];
+        public IntPtr SecondaryAllocationFlags;
+        public int NumBits;
+        public int MaxBits;
+        
+        public int FirstFreeIndex;
+        public int NumFreeIndices;
+    }
+
+    private SparseEnumerationSnapshot _snapshot;
+    private readonly IntPtr _containerAddress;
+    private uint[]? _allocationFlags;
+    private fixed uint _inlineFlags[InlineFlagWords];
+    private int _index;
+
+    private SparseEnumerator(IntPtr containerAddress)
+    {
+        _containerAddress = containerAddress;
+        _index = -1;
+    }
+
+    public int Num => _snapshot.Num;
+    public IntPtr ElementPtr => _snapshot.Data + _index * _snapshot.Stride;
+    public IntPtr KeyPtr => ElementPtr + _snapshot.KeyOffset;
+    public IntPtr ValuePtr => ElementPtr + _snapshot.ValueOffset;
+
+    /// <summary>
+    /// Captures a map. Each enumeration gets its own allocation flags, so nested enumerations of the same map don't interfere.
+    /// </summary>
+    public static SparseEnumerator CaptureMap(IntPtr mapProperty, IntPtr mapAddress)
+    {
+        SparseEnumerator enumerator = new SparseEnumerator(mapAddress);
+        int requiredFlagWords = Bind_FScriptMapHelper.CallGetEnumerationSnapshot(mapProperty, mapAddress, &enumerator._snapshot, enumerator._inlineFlags, InlineFlagWords);
+
+        if (requiredFlagWords > InlineFlagWords)
+        {
+            enumerator._allocationFlags = new uint[requiredFlagWords];
+            fixed (uint* flags = enumerator._allocationFlags)
+            {
+                Bind_FScriptMapHelper.CallGetEnumerationSnapshot(mapProperty, mapAddress, &enumerator._snapshot, flags, requiredFlagWords);
+            }
+        }
+
+        return enumerator;
+    }
+
+    /// <summary>
+    /// Captures a set. Each enumeration gets its own allocation flags, so nested enumerations of the same set don't interfere.
+    /// </summary>
+    public static SparseEnumerator CaptureSet(IntPtr setAddress, IntPtr setProperty)
+    {
+        SparseEnumerator enumerator = new SparseEnumerator(setAddress);
+        int requiredFlagWords = Bind_FScriptSet.CallGetEnumerationSnapshot(setAddress, setProperty, &enumerator._snapshot, enumerator._inlineFlags, InlineFlagWords);
+
+        if (requiredFlagWords > InlineFlagWords)
+        {
+            enumerator._allocationFlags = new uint[requiredFlagWords];
+            fixed (uint* flags = enumerator._allocationFlags)
+            {
+                Bind_FScriptSet.CallGetEnumerationSnapshot(setAddress, setProperty, &enumerator._snapshot, flags, requiredFlagWords);
+            }
+        }
+
+        return enumerator;
+    }
+
+    public bool MoveNext()
+    {
+        ThrowIfModified();
+
+        while (++_index < _snapshot.MaxIndex)
+        {
+            uint flags = _allocationFlags != null ? _allocationFlags[_index >> 5] : _inlineFlags[_index >> 5];
+            if ((flags & (1u << (_index & 31))) != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    private void ThrowIfModified()
+    {
+        ScriptSparseArray* sparseArray = (ScriptSparseArray*) _containerAddress;
+
+        // Reallocations and growth change the data and max index, removals and additions into free slots change the count.
+        if (sparseArray->Data != _snapshot.Data || sparseArray->MaxIndex != _snapshot.MaxIndex || sparseArray->MaxIndex - sparseArray->NumFreeIndices != _snapshot.Num)
+        {
+            throw new InvalidOperationException("Collection was modified; enumeration operation may not execute.");
+        }
+    }
+}
@@ -1,5 +1,7 @@
-﻿using System.Runtime.InteropServices;
+﻿using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
 using UnrealSharp.Core;
+using UnrealSharp.Core.Interop;
 using UnrealSharp.Core.Marshallers;
 using UnrealSharp.Interop;
 
@@ -37,12 +39,24 @@ public abstract unsafe class UnrealArrayBase<T> : IEnumerable<T>
     
     protected UnmanagedArray* NativeBuffer { get; }
 
+    /// <summary>
+    /// True if the elements are marshalled by copying their memory, so ranges can be copied to native in one call.
+    /// </summary>
+    protected bool IsBlittable { get; }
+
     protected UnrealArrayBase(IntPtr nativeProperty, IntPtr nativeBuffer, MarshallingDelegates<T>.ToNative toNative, MarshallingDelegates<T>.FromNative fromNative)
     {
         NativeProperty = nativeProperty;
         NativeBuffer = (UnmanagedArray*) nativeBuffer;
         FromNative = fromNative;
         ToNative = toNative;
+        IsBlittable = IsBlittableMarshaller(toNative);
+    }
+
+    internal static bool IsBlittableMarshaller(MarshallingDelegates<T>.ToNative toNative)
+    {
+        Type? marshallerType = toNative.Method.DeclaringType;
+        return marshallerType is { IsGenericType: true } && marshallerType.GetGenericTypeDefinition() == typeof(BlittableMarshaller<>);
     }
 
     /// <summary>
@@ -89,6 +103,47 @@ public abstract unsafe class UnrealArrayBase<T> : IEnumerable<T>
         Bind_FArrayProperty.CallRemoveFromArray(NativeProperty, NativeBuffer, index);
     }
 
+    /// <summary>
+    /// Inserts a range of default constructed elements into the array at the specified index.
+    /// </summary>
+    /// <param name="index"> The index to insert the elements at. </param>
+    /// <param name="count"> The number of elements to insert. </param>
+    protected void InsertRangeInternal(int index, int count)
+    {
+        Bind_FScriptArray.CallInsertZeroed(NativeBuffer, NativeProperty, index, count);
+    }
+
+    /// <summary>
+    /// Removes a range of elements from the array, destructing them first.
+    /// </summary>
+    /// <param name="index"> The index of the first element to remove. </param>
+    /// <param name="count"> The number of elements to remove. </param>
+    protected void RemoveRangeInternal(int index, int count)
+    {
+        Bind_FScriptArray.CallRemoveAt(NativeBuffer, NativeProperty, index, count);
+    }
+
+    /// <summary>
+    /// Copies a range of elements into the array starting at the specified index, using a single memory copy when the elements are blittable.
+    /// The elements in the range must already exist.
+    /// </summary>
+    /// <param name="index"> The index of the first element to write. </param>
+    /// <param name="items"> The elements to copy. </param>
+    protected void CopyRangeToNative(int index, ReadOnlySpan<T> items)
+    {
+        if (IsBlittable)
+        {
+            ref byte source = ref Unsafe.As<T, byte>(ref MemoryMarshal.GetReference(items));
+            Unsafe.CopyBlockUnaligned(ref Unsafe.AsRef<byte>((void*) (NativeArrayBuffer + index * Unsafe.SizeOf<T>())), ref source, (uint) (items.Length * Unsafe.SizeOf<T>()));
+            return;
+        }
+
+        for (int i = 0; i < items.Length; ++i)
+        {
+            ToNative(NativeArrayBuffer, index + i, items[i]);
+        }
+    }
+
     /// <summary>
     /// Gets the element at the specified index.
     /// </summary>
@@ -161,6 +216,12 @@ public class ArrayCopyMarshaller<T>
                 return;
             }
 
+            if (obj is IList<string> strings)
+            {
+                StringMarshaller.ToNativeArray((IntPtr) mirror, strings);
+                return;
+            }
+
             var enumerable = obj.ToList();
             int count = enumerable.Count;
             
@@ -1,6 +1,29 @@
 #include "CSBindsRegistry.h"
 #include "UnrealSharpBinds.h"
 #include "Logging/StructuredLog.h"
+#include <atomic>
+
+namespace
+{
+	// Binds are resolved from the assembly preload workers as well, so both counters are atomic.
+	std::atomic<int32> NumResolvedBoundFunctions = 0;
+	std::atomic<uint64> BoundFunctionResolveCycles = 0;
+	
+	struct FScopedResolveTimer
+	{
+		explicit FScopedResolveTimer(int32 InNumFunctions) : StartCycles(FPlatformTime::Cycles64())
+		{
+			NumResolvedBoundFunctions.fetch_add(InNumFunctions, std::memory_order_relaxed);
+		}
+		
+		~FScopedResolveTimer()
+		{
+			BoundFunctionResolveCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+		}
+		
+		uint64 StartCycles;
+	};
+}
 
 void DumpBoundFunctionsInternal(const FName& BinderName)
 {
@@ -28,6 +51,7 @@ void DumpBoundFunctionsInternal(const FName& BinderName)
 void DumpBoundFunctions(const TArray<FString>& Args)
 {
 	UE_LOG(LogUnrealSharpBinds, Log, TEXT("Dumping exported functions:"));
+	UE_LOGFMT(LogUnrealSharpBinds, Log, "Resolved {0} bound functions in {1} ms", NumResolvedBoundFunctions.load(), FPlatformTime::ToMilliseconds64(BoundFunctionResolveCycles.load()));
 	
 	for (const TPair<FName, TArray<FCSBoundFunction>>& ExportedFunctionsKVP : FCSBindsRegistry::GetBinderToFunctionsMap())
 	{
@@ -60,56 +84,84 @@ static FAutoConsoleCommand CVarDumpBoundFunctionsForBinder(
 );
 
 TMap<FName, TArray<FCSBoundFunction>> FCSBindsRegistry::BinderToFunctionsMap;
+TMap<FCSBoundFunctionKey, FCSBoundFunction> FCSBindsRegistry::BoundFunctionLookup;
 
 const FCSBoundFunction& FCSBindsRegistry::RegisterBoundFunction(const FName& BinderName, const FName& FunctionName, void* FunctionPointer, int32 ParameterSize)
 {
 	TArray<FCSBoundFunction>& ExportedFunctions = BinderToFunctionsMap.FindOrAdd(BinderName);
 	const FCSBoundFunction& BoundFunction = ExportedFunctions.Emplace_GetRef(FunctionName, ParameterSize, FunctionPointer);
 	
+	BoundFunctionLookup.Add(FCSBoundFunctionKey{ BinderName, FunctionName }, BoundFunction);
+	
 	UE_LOGFMT(LogUnrealSharpBinds, Verbose, "Registered bound function {0}.{1} with parameter size {2}", *BinderName.ToString(), *FunctionName.ToString(), ParameterSize);
 	return BoundFunction;
 }
 
 void* FCSBindsRegistry::GetBoundFunction(const TCHAR* BinderName, const TCHAR* FunctionName, int32 ParameterSize)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBindsManager::GetBoundFunction);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBindsRegistry::GetBoundFunction);
+	FScopedResolveTimer ResolveTimer(1);
 	
-	FName ManagedOuterName = FName(BinderName);
-	FName ManagedFunctionName = FName(FunctionName);
+	const FName ManagedOuterName(BinderName, FNAME_Find);
 	
-	TArray<FCSBoundFunction>* BoundFunctions = BinderToFunctionsMap.Find(ManagedOuterName);
-
-	if (!BoundFunctions)
+	if (ManagedOuterName.IsNone() || !BinderToFunctionsMap.Contains(ManagedOuterName))
 	{
 		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No exported functions found for %s"), BinderName);
 		return nullptr;
 	}
 
-	void* FunctionPointer = nullptr;
-	for (const FCSBoundFunction& NativeFunction : *BoundFunctions)
+	return FindBoundFunction(ManagedOuterName, FunctionName, ParameterSize);
+}
+
+int32 FCSBindsRegistry::GetBoundFunctions(const TCHAR* BinderName, const TCHAR** FunctionNames, const int32* ParameterSizes, int32 NumFunctions, void** OutFunctionPointers)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBindsRegistry::GetBoundFunctions);
+	FScopedResolveTimer ResolveTimer(NumFunctions);
+	
+	FMemory::Memzero(OutFunctionPointers, NumFunctions * sizeof(void*));
+	
+	const FName ManagedOuterName(BinderName, FNAME_Find);
+	
+	if (ManagedOuterName.IsNone() || !BinderToFunctionsMap.Contains(ManagedOuterName))
 	{
-		if (NativeFunction.FunctionName != ManagedFunctionName)
-		{
-			continue;
-		}
-			
-		if (NativeFunction.ParameterSize != ParameterSize)
-		{
-			UE_LOGFMT(LogUnrealSharpBinds, Error, "Failed to get BoundNativeFunction: Function size mismatch for {0}.{1} (expected {2}, got {3})",
-				*ManagedOuterName.ToString(), *ManagedFunctionName.ToString(), NativeFunction.ParameterSize, ParameterSize);
-			
-			break;
-		}
-			
-		FunctionPointer = NativeFunction.FunctionPointer;
-		break;
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunctions: No exported functions found for %s"), BinderName);
+		return 0;
+	}
+
+	int32 NumResolved = 0;
+	for (int32 i = 0; i < NumFunctions; ++i)
+	{
+		OutFunctionPointers[i] = FindBoundFunction(ManagedOuterName, FunctionNames[i], ParameterSizes[i]);
+		NumResolved += OutFunctionPointers[i] != nullptr;
+	}
+	
+	return NumResolved;
+}
+
+const FCSBindsCallbacks& FCSBindsRegistry::GetBindsCallbacks()
+{
+	static const FCSBindsCallbacks Callbacks { &FCSBindsRegistry::GetBoundFunction, &FCSBindsRegistry::GetBoundFunctions };
+	return Callbacks;
+}
+
+void* FCSBindsRegistry::FindBoundFunction(FName BinderName, const TCHAR* FunctionName, int32 ParameterSize)
+{
+	const FName ManagedFunctionName(FunctionName, FNAME_Find);
+	const FCSBoundFunction* NativeFunction = ManagedFunctionName.IsNone() ? nullptr : BoundFunctionLookup.Find(FCSBoundFunctionKey{ BinderName, ManagedFunctionName });
+	
+	if (!NativeFunction)
+	{
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No function found for %s.%s"), *BinderName.ToString(), FunctionName);
+		return nullptr;
 	}
 	
-	if (!FunctionPointer)
+	if (NativeFunction->ParameterSize != ParameterSize)
 	{
-		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No function found for %s.%s"), *ManagedOuterName.ToString(), *ManagedFunctionName.ToString());
+		UE_LOGFMT(LogUnrealSharpBinds, Error, "Failed to get BoundNativeFunction: Function size mismatch for {0}.{1} (expected {2}, got {3})",
+			*BinderName.ToString(), FunctionName, NativeFunction->ParameterSize, ParameterSize);
+		
 		return nullptr;
 	}
 	
-	return FunctionPointer;
+	return NativeFunction->FunctionPointer;
 }
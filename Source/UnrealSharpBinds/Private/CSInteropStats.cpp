@@ -0,0 +1,335 @@
+#include "CSInteropStats.h"
+
+#if UNREALSHARP_INTEROP_STATS
+
+#include "UnrealSharpBinds.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(UnrealSharp_InteropCalls, TEXT("UnrealSharp/InteropCalls"));
+TRACE_DECLARE_FLOAT_COUNTER(UnrealSharp_InteropMilliseconds, TEXT("UnrealSharp/InteropMilliseconds"));
+
+namespace UnrealSharp::InteropStats
+{
+	struct FCounterInfo
+	{
+		FName OwnerName;
+		FName FunctionName;
+	};
+
+	struct FCounterSample
+	{
+		std::atomic<uint64> Calls { 0 };
+		std::atomic<uint64> Cycles { 0 };
+		std::atomic<uint64> Histogram[NumHistogramBuckets] = {};
+	};
+
+	struct FCounterTotals
+	{
+		uint64 Calls = 0;
+		uint64 Cycles = 0;
+		uint64 Histogram[NumHistogramBuckets] = {};
+	};
+
+	// Samples are only ever written by the thread that owns the buffer, and read with relaxed loads when reporting.
+	// Pages are allocated on first use so a thread only pays for the counters it actually hits.
+	struct FThreadBuffer
+	{
+		static constexpr int32 PageSize = 64;
+		static constexpr int32 MaxPages = 256;
+
+		std::atomic<FCounterSample*> Pages[MaxPages] = {};
+
+		FCounterSample& GetSample(int32 CounterIndex)
+		{
+			std::atomic<FCounterSample*>& Page = Pages[CounterIndex / PageSize];
+			FCounterSample* PageData = Page.load(std::memory_order_acquire);
+
+			if (!PageData)
+			{
+				PageData = new FCounterSample[PageSize];
+				Page.store(PageData, std::memory_order_release);
+			}
+
+			return PageData[CounterIndex % PageSize];
+		}
+	};
+
+	struct FRegistry
+	{
+		FCriticalSection Lock;
+		TArray<FCounterInfo> Counters;
+
+		// Buffers outlive their threads, so calls made on short-lived threads are still reported.
+		TArray<FThreadBuffer*> ThreadBuffers;
+
+		uint64 LastFrameCalls = 0;
+		uint64 LastFrameCycles = 0;
+	};
+
+	FRegistry& GetRegistry()
+	{
+		static FRegistry Registry;
+		return Registry;
+	}
+
+	FThreadBuffer& GetThreadBuffer()
+	{
+		thread_local FThreadBuffer* ThreadBuffer = nullptr;
+
+		if (!ThreadBuffer)
+		{
+			ThreadBuffer = new FThreadBuffer();
+
+			FRegistry& Registry = GetRegistry();
+			FScopeLock Lock(&Registry.Lock);
+			Registry.ThreadBuffers.Add(ThreadBuffer);
+		}
+
+		return *ThreadBuffer;
+	}
+
+	int32 RegisterCounter(const FName& OwnerName, const FName& FunctionName)
+	{
+		FRegistry& Registry = GetRegistry();
+		FScopeLock Lock(&Registry.Lock);
+
+		const int32 CounterIndex = Registry.Counters.Add(FCounterInfo { OwnerName, FunctionName });
+		check(CounterIndex < FThreadBuffer::PageSize * FThreadBuffer::MaxPages);
+		return CounterIndex;
+	}
+
+	void RecordCall(int32 CounterIndex, uint64 Cycles)
+	{
+		FCounterSample& Sample = GetThreadBuffer().GetSample(CounterIndex);
+		const int32 Bucket = FMath::Min<int32>(FMath::FloorLog2_64(Cycles | 1), NumHistogramBuckets - 1);
+
+		Sample.Calls.store(Sample.Calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		Sample.Cycles.store(Sample.Cycles.load(std::memory_order_relaxed) + Cycles, std::memory_order_relaxed);
+		Sample.Histogram[Bucket].store(Sample.Histogram[Bucket].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	TArray<FCounterTotals> GatherTotals(TArray<FCounterInfo>& OutCounters)
+	{
+		FRegistry& Registry = GetRegistry();
+		FScopeLock Lock(&Registry.Lock);
+
+		OutCounters = Registry.Counters;
+
+		TArray<FCounterTotals> Totals;
+		Totals.SetNum(Registry.Counters.Num());
+
+		for (FThreadBuffer* ThreadBuffer : Registry.ThreadBuffers)
+		{
+			for (int32 PageIndex = 0; PageIndex < FThreadBuffer::MaxPages; ++PageIndex)
+			{
+				FCounterSample* PageData = ThreadBuffer->Pages[PageIndex].load(std::memory_order_acquire);
+				if (!PageData)
+				{
+					continue;
+				}
+
+				const int32 FirstIndex = PageIndex * FThreadBuffer::PageSize;
+				const int32 NumInPage = FMath::Min(FThreadBuffer::PageSize, Totals.Num() - FirstIndex);
+
+				for (int32 Index = 0; Index < NumInPage; ++Index)
+				{
+					const FCounterSample& Sample = PageData[Index];
+					FCounterTotals& Total = Totals[FirstIndex + Index];
+
+					Total.Calls += Sample.Calls.load(std::memory_order_relaxed);
+					Total.Cycles += Sample.Cycles.load(std::memory_order_relaxed);
+
+					for (int32 Bucket = 0; Bucket < NumHistogramBuckets; ++Bucket)
+					{
+						Total.Histogram[Bucket] += Sample.Histogram[Bucket].load(std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+
+		return Totals;
+	}
+
+	// Approximates a percentile from the histogram, returning the upper bound of the bucket it falls into.
+	double GetPercentileMicroseconds(const FCounterTotals& Total, double Percentile)
+	{
+		const uint64 TargetCalls = FMath::CeilToInt64(Total.Calls * Percentile);
+		uint64 SeenCalls = 0;
+
+		for (int32 Bucket = 0; Bucket < NumHistogramBuckets; ++Bucket)
+		{
+			SeenCalls += Total.Histogram[Bucket];
+			if (SeenCalls >= TargetCalls)
+			{
+				return FPlatformTime::ToMilliseconds64(2ull << Bucket) * 1000.0;
+			}
+		}
+
+		return FPlatformTime::ToMilliseconds64(Total.Cycles) * 1000.0;
+	}
+
+	void ResetStats()
+	{
+		FRegistry& Registry = GetRegistry();
+		FScopeLock Lock(&Registry.Lock);
+
+		for (FThreadBuffer* ThreadBuffer : Registry.ThreadBuffers)
+		{
+			for (std::atomic<FCounterSample*>& Page : ThreadBuffer->Pages)
+			{
+				FCounterSample* PageData = Page.load(std::memory_order_acquire);
+				if (!PageData)
+				{
+					continue;
+				}
+
+				// Racing with the owning thread can lose a few samples, which is fine for a reset.
+				for (int32 Index = 0; Index < FThreadBuffer::PageSize; ++Index)
+				{
+					PageData[Index].Calls.store(0, std::memory_order_relaxed);
+					PageData[Index].Cycles.store(0, std::memory_order_relaxed);
+
+					for (std::atomic<uint64>& Bucket : PageData[Index].Histogram)
+					{
+						Bucket.store(0, std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+
+		Registry.LastFrameCalls = 0;
+		Registry.LastFrameCycles = 0;
+	}
+
+	void DumpStats(const TArray<FString>& Args)
+	{
+		const int32 MaxRows = Args.IsEmpty() ? 50 : FCString::Atoi(*Args[0]);
+
+		TArray<FCounterInfo> Counters;
+		TArray<FCounterTotals> Totals = GatherTotals(Counters);
+
+		TArray<int32> SortedIndices;
+		for (int32 Index = 0; Index < Totals.Num(); ++Index)
+		{
+			if (Totals[Index].Calls > 0)
+			{
+				SortedIndices.Add(Index);
+			}
+		}
+
+		SortedIndices.Sort([&Totals](int32 A, int32 B)
+		{
+			return Totals[A].Cycles > Totals[B].Cycles;
+		});
+
+		UE_LOGFMT(LogUnrealSharpBinds, Log, "Interop stats for {0} of {1} edges, sorted by total time:", SortedIndices.Num(), Counters.Num());
+
+		for (int32 Row = 0; Row < FMath::Min(MaxRows, SortedIndices.Num()); ++Row)
+		{
+			const FCounterInfo& Counter = Counters[SortedIndices[Row]];
+			const FCounterTotals& Total = Totals[SortedIndices[Row]];
+
+			UE_LOGFMT(LogUnrealSharpBinds, Log, "	{0}.{1} | Calls: {2} | Total: {3} ms | Avg: {4} us | P50: {5} us | P99: {6} us",
+				Counter.OwnerName.ToString(), Counter.FunctionName.ToString(), Total.Calls,
+				FPlatformTime::ToMilliseconds64(Total.Cycles),
+				FPlatformTime::ToMilliseconds64(Total.Cycles) * 1000.0 / Total.Calls,
+				GetPercentileMicroseconds(Total, 0.5), GetPercentileMicroseconds(Total, 0.99));
+		}
+	}
+
+	void WriteStatsCsv(const TArray<FString>& Args)
+	{
+		const FString FilePath = Args.IsEmpty()
+			? FPaths::ProfilingDir() / TEXT("UnrealSharp") / FString::Printf(TEXT("InteropStats-%s.csv"), *FDateTime::Now().ToString())
+			: Args[0];
+
+		TArray<FCounterInfo> Counters;
+		TArray<FCounterTotals> Totals = GatherTotals(Counters);
+
+		TStringBuilder<16384> Csv;
+		Csv << TEXT("Owner,Function,Calls,TotalMs,AvgUs,P50Us,P99Us");
+		for (int32 Bucket = 0; Bucket < NumHistogramBuckets; ++Bucket)
+		{
+			Csv.Appendf(TEXT(",Bucket%d"), Bucket);
+		}
+		Csv << LINE_TERMINATOR;
+
+		for (int32 Index = 0; Index < Totals.Num(); ++Index)
+		{
+			const FCounterInfo& Counter = Counters[Index];
+			const FCounterTotals& Total = Totals[Index];
+
+			if (Total.Calls == 0)
+			{
+				continue;
+			}
+
+			Csv.Appendf(TEXT("%s,%s,%llu,%f,%f,%f,%f"), *Counter.OwnerName.ToString(), *Counter.FunctionName.ToString(), Total.Calls,
+				FPlatformTime::ToMilliseconds64(Total.Cycles),
+				FPlatformTime::ToMilliseconds64(Total.Cycles) * 1000.0 / Total.Calls,
+				GetPercentileMicroseconds(Total, 0.5), GetPercentileMicroseconds(Total, 0.99));
+
+			for (uint64 BucketCalls : Total.Histogram)
+			{
+				Csv.Appendf(TEXT(",%llu"), BucketCalls);
+			}
+
+			Csv << LINE_TERMINATOR;
+		}
+
+		if (!FFileHelper::SaveStringToFile(Csv.ToView(), *FilePath))
+		{
+			UE_LOGFMT(LogUnrealSharpBinds, Error, "Failed to write interop stats to {0}", FilePath);
+			return;
+		}
+
+		UE_LOGFMT(LogUnrealSharpBinds, Log, "Wrote interop stats to {0}", FPaths::ConvertRelativePathToFull(FilePath));
+	}
+
+	void TraceFrameTotals()
+	{
+		TArray<FCounterInfo> Counters;
+		TArray<FCounterTotals> Totals = GatherTotals(Counters);
+
+		uint64 Calls = 0;
+		uint64 Cycles = 0;
+		for (const FCounterTotals& Total : Totals)
+		{
+			Calls += Total.Calls;
+			Cycles += Total.Cycles;
+		}
+
+		FRegistry& Registry = GetRegistry();
+		const uint64 FrameCalls = Calls >= Registry.LastFrameCalls ? Calls - Registry.LastFrameCalls : Calls;
+		const uint64 FrameCycles = Cycles >= Registry.LastFrameCycles ? Cycles - Registry.LastFrameCycles : Cycles;
+
+		Registry.LastFrameCalls = Calls;
+		Registry.LastFrameCycles = Cycles;
+
+		TRACE_COUNTER_SET(UnrealSharp_InteropCalls, FrameCalls);
+		TRACE_COUNTER_SET(UnrealSharp_InteropMilliseconds, FPlatformTime::ToMilliseconds64(FrameCycles));
+	}
+
+	static FAutoConsoleCommand CVarDumpInteropStats(
+		TEXT("UnrealSharp.DumpInteropStats"),
+		TEXT("Dumps call counts and latencies of the most expensive interop edges to the log. Usage: UnrealSharp.DumpInteropStats [MaxRows]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&DumpStats)
+	);
+
+	static FAutoConsoleCommand CVarWriteInteropStatsCsv(
+		TEXT("UnrealSharp.WriteInteropStatsCsv"),
+		TEXT("Writes call counts and latency histograms of every interop edge to a CSV file. Usage: UnrealSharp.WriteInteropStatsCsv [FilePath]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&WriteStatsCsv)
+	);
+
+	static FAutoConsoleCommand CVarResetInteropStats(
+		TEXT("UnrealSharp.ResetInteropStats"),
+		TEXT("Clears all recorded interop stats."),
+		FConsoleCommandDelegate::CreateStatic(&ResetStats)
+	);
+}
+
+#endif
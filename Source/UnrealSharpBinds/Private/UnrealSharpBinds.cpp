@@ -1,4 +1,6 @@
 ﻿#include "UnrealSharpBinds.h"
+#include "CSInteropStats.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpBindsModule"
 
@@ -6,6 +8,9 @@ DEFINE_LOG_CATEGORY(LogUnrealSharpBinds);
 
 void FUnrealSharpBindsModule::StartupModule()
 {
+#if UNREALSHARP_INTEROP_STATS
+	FCoreDelegates::OnEndFrame.AddStatic(&UnrealSharp::InteropStats::TraceFrameTotals);
+#endif
 }
 
 void FUnrealSharpBindsModule::ShutdownModule()
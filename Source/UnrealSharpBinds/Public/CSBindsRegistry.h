@@ -1,5 +1,7 @@
 #pragma once
 
+#include "CSInteropStats.h"
+
 template <typename T>
 struct TArgSize
 {
@@ -35,23 +37,67 @@ struct FCSBoundFunction
 	void* FunctionPointer;
 };
 
+struct FCSBoundFunctionKey
+{
+	FName BinderName;
+	FName FunctionName;
+
+	bool operator==(const FCSBoundFunctionKey& Other) const
+	{
+		return BinderName == Other.BinderName && FunctionName == Other.FunctionName;
+	}
+
+	friend uint32 GetTypeHash(const FCSBoundFunctionKey& Key)
+	{
+		return HashCombineFast(GetTypeHash(Key.BinderName), GetTypeHash(Key.FunctionName));
+	}
+};
+
+// Passed to the managed side on startup so the BindsManager can resolve bound functions.
+struct FCSBindsCallbacks
+{
+	using GetBoundFunctionCallback = void*(*)(const TCHAR*, const TCHAR*, int32);
+	using GetBoundFunctionsCallback = int32(*)(const TCHAR*, const TCHAR**, const int32*, int32, void**);
+
+	GetBoundFunctionCallback GetBoundFunction;
+	GetBoundFunctionsCallback GetBoundFunctions;
+};
+
 #define DECLARE_UNREALSHARP_BINDER(Name) \
 namespace Name { static const FName UnrealSharpBinderName(#Name); } \
 namespace Name
 
+#if UNREALSHARP_INTEROP_STATS
+// Hands out a thunk in place of the function, which records every call into the interop stats.
+#define BIND_UNREALSHARP_FUNCTION(FunctionName) \
+static const FCSBoundFunction ANONYMOUS_VARIABLE(ZUnrealSharpBind_) = FCSBindsRegistry::RegisterBoundFunction( \
+UnrealSharpBinderName, \
+FName(#FunctionName), \
+(void*)UnrealSharp::InteropStats::MakeCallThunk<&FunctionName>(&FunctionName, UnrealSharp::InteropStats::RegisterCounter(UnrealSharpBinderName, FName(#FunctionName))), \
+static_cast<int32>(GetFunctionSize(&FunctionName)));
+#else
 #define BIND_UNREALSHARP_FUNCTION(FunctionName) \
 static const FCSBoundFunction ANONYMOUS_VARIABLE(ZUnrealSharpBind_) = FCSBindsRegistry::RegisterBoundFunction( \
 UnrealSharpBinderName, \
 FName(#FunctionName), \
 (void*)&FunctionName, \
 static_cast<int32>(GetFunctionSize(&FunctionName)));
+#endif
 
 class FCSBindsRegistry
 {
 public:
 	UNREALSHARPBINDS_API static const FCSBoundFunction& RegisterBoundFunction(const FName& BinderName, const FName& FunctionName, void* FunctionPointer, int32 ParameterSize);
 	UNREALSHARPBINDS_API static void* GetBoundFunction(const TCHAR* BinderName, const TCHAR* FunctionName, int32 ParameterSize);
+	
+	// Resolves every function of one binder in a single call. Returns the number of functions that were resolved.
+	UNREALSHARPBINDS_API static int32 GetBoundFunctions(const TCHAR* BinderName, const TCHAR** FunctionNames, const int32* ParameterSizes, int32 NumFunctions, void** OutFunctionPointers);
+	
 	UNREALSHARPBINDS_API static const TMap<FName, TArray<FCSBoundFunction>>& GetBinderToFunctionsMap() { return BinderToFunctionsMap; }
+	UNREALSHARPBINDS_API static const FCSBindsCallbacks& GetBindsCallbacks();
 private:
+	static void* FindBoundFunction(FName BinderName, const TCHAR* FunctionName, int32 ParameterSize);
+	
 	static TMap<FName, TArray<FCSBoundFunction>> BinderToFunctionsMap;
+	static TMap<FCSBoundFunctionKey, FCSBoundFunction> BoundFunctionLookup;
 };
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef UNREALSHARP_INTEROP_STATS
+#define UNREALSHARP_INTEROP_STATS 0
+#endif
+
+#if UNREALSHARP_INTEROP_STATS
+
+// Call counts and latency histograms for every interop edge, recorded into per-thread buffers.
+// Only compiled in when UNREALSHARP_INTEROP_STATS is set, see UnrealSharpBinds.Build.cs.
+namespace UnrealSharp::InteropStats
+{
+	// Latencies are bucketed by the log2 of their duration in cycles.
+	static constexpr int32 NumHistogramBuckets = 32;
+
+	// Registers an interop edge and returns the index its samples are recorded under.
+	UNREALSHARPBINDS_API int32 RegisterCounter(const FName& OwnerName, const FName& FunctionName);
+
+	UNREALSHARPBINDS_API void RecordCall(int32 CounterIndex, uint64 Cycles);
+
+	// Publishes the calls and time spent in interop since the previous frame as Insights counter tracks.
+	void TraceFrameTotals();
+
+	struct FScopedCallTimer
+	{
+		explicit FScopedCallTimer(int32 InCounterIndex) : CounterIndex(InCounterIndex), StartCycles(FPlatformTime::Cycles64())
+		{
+		}
+
+		~FScopedCallTimer()
+		{
+			RecordCall(CounterIndex, FPlatformTime::Cycles64() - StartCycles);
+		}
+
+		int32 CounterIndex;
+		uint64 StartCycles;
+	};
+
+	// A function with the same signature as the one it wraps, so it can be handed out in place of the original pointer.
+	// Tag only has to be unique per wrapped function.
+	template <auto Tag, typename ReturnType, typename... Args>
+	struct TCallThunk
+	{
+		static inline ReturnType(*Target)(Args...) = nullptr;
+		static inline int32 CounterIndex = INDEX_NONE;
+
+		static ReturnType Call(Args... InArgs)
+		{
+			FScopedCallTimer Timer(CounterIndex);
+			return Target(InArgs...);
+		}
+	};
+
+	template <auto Tag, typename ReturnType, typename... Args>
+	auto MakeCallThunk(ReturnType(*Target)(Args...), int32 CounterIndex) -> ReturnType(*)(Args...)
+	{
+		using FThunk = TCallThunk<Tag, ReturnType, Args...>;
+		FThunk::Target = Target;
+		FThunk::CounterIndex = CounterIndex;
+		return &FThunk::Call;
+	}
+}
+
+#endif
@@ -1,4 +1,5 @@
-﻿using UnrealBuildTool;
+﻿using System;
+using UnrealBuildTool;
 
 public class UnrealSharpBinds : ModuleRules
 {
@@ -6,6 +7,10 @@ public class UnrealSharpBinds : ModuleRules
     {
         PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 
+        // Set UNREALSHARP_INTEROP_STATS=1 in the environment to record call counts and latencies for every interop edge.
+        bool bEnableInteropStats = Target.Configuration != UnrealTargetConfiguration.Shipping && Environment.GetEnvironmentVariable("UNREALSHARP_INTEROP_STATS") == "1";
+        PublicDefinitions.Add("UNREALSHARP_INTEROP_STATS=" + (bEnableInteropStats ? 1 : 0));
+
         PublicDependencyModuleNames.AddRange(
             new string[]
             {
@@ -207,6 +207,7 @@ void FCSCompilerContext::GenerateFunctions() const
 	TSharedPtr<const FCSClassReflectionData> ReflectionData = GetReflectionData();
 	FCSFunctionFactory::GenerateVirtualFunctions(NewClass, ReflectionData);
 	FCSFunctionFactory::GenerateFunctions(NewClass, ReflectionData->Functions);
+	FCSFunctionFactory::UpdateMethodHandles(NewClass);
 }
 
 UCSClass* FCSCompilerContext::GetMainClass() const
@@ -9,7 +9,15 @@ DECLARE_UNREALSHARP_BINDER(Bind_FName)
 
 	void StringToName(FName* Name, const UTF16CHAR* String, int32 Length)
 	{
-		*Name = FName(TStringView(String, Length));
+		if constexpr (sizeof(TCHAR) == sizeof(UTF16CHAR))
+		{
+			// Hashed and looked up straight from the managed buffer, without a TCHAR conversion.
+			*Name = FName(FStringView(reinterpret_cast<const TCHAR*>(String), Length));
+		}
+		else
+		{
+			*Name = FName(TStringView(String, Length));
+		}
 	}
 
 	bool IsValid(FName Name)
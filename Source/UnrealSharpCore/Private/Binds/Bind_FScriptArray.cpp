@@ -26,10 +26,77 @@ DECLARE_UNREALSHARP_BINDER(Bind_FScriptArray)
 	{
 		Instance->~FScriptArray();
 	}
+
+	// The bulk operations below resize the array once and move the elements with a single memmove,
+	// instead of one interop call per element.
+	void Reserve(FScriptArray* Instance, FArrayProperty* ArrayProperty, int32 Number)
+	{
+		if (Number <= Instance->Max())
+		{
+			return;
+		}
+
+		const FProperty* Inner = ArrayProperty->Inner;
+		const int32 OldNum = Instance->Num();
+		Instance->Add(Number - OldNum, Inner->GetSize(), Inner->GetMinAlignment());
+		Instance->Remove(OldNum, Number - OldNum, Inner->GetSize(), Inner->GetMinAlignment(), EAllowShrinking::No);
+	}
+
+	void InsertZeroed(FScriptArray* Instance, FArrayProperty* ArrayProperty, int32 Index, int32 Count)
+	{
+		FScriptArrayHelper Helper(ArrayProperty, Instance);
+		Helper.InsertValues(Index, Count);
+	}
+
+	void RemoveAt(FScriptArray* Instance, FArrayProperty* ArrayProperty, int32 Index, int32 Count)
+	{
+		FScriptArrayHelper Helper(ArrayProperty, Instance);
+		Helper.RemoveValues(Index, Count);
+	}
+
+	void SetNumUninitialized(FScriptArray* Instance, FArrayProperty* ArrayProperty, int32 NewNum)
+	{
+		FScriptArrayHelper Helper(ArrayProperty, Instance);
+		const int32 OldNum = Helper.Num();
+
+		if (NewNum > OldNum)
+		{
+			Helper.AddUninitializedValues(NewNum - OldNum);
+		}
+		else if (NewNum < OldNum)
+		{
+			Helper.RemoveValues(NewNum, OldNum - NewNum);
+		}
+	}
+
+	void Shrink(FScriptArray* Instance, FArrayProperty* ArrayProperty)
+	{
+		const FProperty* Inner = ArrayProperty->Inner;
+		Instance->Shrink(Inner->GetSize(), Inner->GetMinAlignment());
+	}
+
+	// Only valid for element types whose managed and native layouts match.
+	void Append(FScriptArray* Instance, FArrayProperty* ArrayProperty, const void* Source, int32 Count)
+	{
+		if (Count <= 0)
+		{
+			return;
+		}
+
+		FScriptArrayHelper Helper(ArrayProperty, Instance);
+		const int32 OldNum = Helper.AddUninitializedValues(Count);
+		FMemory::Memcpy(Helper.GetRawPtr(OldNum), Source, static_cast<SIZE_T>(Count) * ArrayProperty->Inner->GetSize());
+	}
 	
 	BIND_UNREALSHARP_FUNCTION(GetData)
 	BIND_UNREALSHARP_FUNCTION(IsValidIndex)
 	BIND_UNREALSHARP_FUNCTION(Add)
 	BIND_UNREALSHARP_FUNCTION(Num)
 	BIND_UNREALSHARP_FUNCTION(Destroy)
+	BIND_UNREALSHARP_FUNCTION(Reserve)
+	BIND_UNREALSHARP_FUNCTION(InsertZeroed)
+	BIND_UNREALSHARP_FUNCTION(RemoveAt)
+	BIND_UNREALSHARP_FUNCTION(SetNumUninitialized)
+	BIND_UNREALSHARP_FUNCTION(Shrink)
+	BIND_UNREALSHARP_FUNCTION(Append)
 }
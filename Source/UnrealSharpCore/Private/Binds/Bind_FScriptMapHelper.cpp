@@ -1,4 +1,5 @@
 ﻿#include "CSBindsRegistry.h"
+#include "CSSparseEnumerationSnapshot.h"
 
 DECLARE_UNREALSHARP_BINDER(Bind_FScriptMapHelper)
 {
@@ -61,6 +62,21 @@ DECLARE_UNREALSHARP_BINDER(Bind_FScriptMapHelper)
 		FScriptMapHelper Helper(MapProperty, Address);
 		return Helper.GetPairPtr(Index);
 	}
+
+	int32 GetEnumerationSnapshot(FMapProperty* MapProperty, const void* Address, FCSSparseEnumerationSnapshot* OutSnapshot, uint32* AllocationFlags, int32 NumFlagWords)
+	{
+		FScriptMap* Map = static_cast<FScriptMap*>(const_cast<void*>(Address));
+		const FScriptMapLayout& MapLayout = MapProperty->MapLayout;
+
+		OutSnapshot->Data = static_cast<uint8*>(Map->GetData(0, MapLayout));
+		OutSnapshot->MaxIndex = Map->GetMaxIndex();
+		OutSnapshot->Num = Map->Num();
+		OutSnapshot->Stride = MapLayout.SetLayout.Size;
+		OutSnapshot->KeyOffset = MapProperty->KeyProp->GetOffset_ForInternal();
+		OutSnapshot->ValueOffset = MapProperty->ValueProp->GetOffset_ForInternal();
+
+		return OutSnapshot->WriteAllocationFlags(AllocationFlags, NumFlagWords, [Map](int32 Index) { return Map->IsValidIndex(Index); });
+	}
 	
 	BIND_UNREALSHARP_FUNCTION(AddPair)
 	BIND_UNREALSHARP_FUNCTION(FindOrAdd)
@@ -72,4 +88,5 @@ DECLARE_UNREALSHARP_BINDER(Bind_FScriptMapHelper)
 	BIND_UNREALSHARP_FUNCTION(IsValidIndex)
 	BIND_UNREALSHARP_FUNCTION(GetMaxIndex)
 	BIND_UNREALSHARP_FUNCTION(GetPairPtr)
+	BIND_UNREALSHARP_FUNCTION(GetEnumerationSnapshot)
 }
@@ -1,12 +1,8 @@
 ﻿#include "CSBindsRegistry.h"
+#include "CSSparseEnumerationSnapshot.h"
 
 DECLARE_UNREALSHARP_BINDER(Bind_FScriptSet)
 {
-	using FGetKeyHash = uint32(*)(const void*);
-	using FEqualityFn = bool(*)(const void*, const void*);
-	using FConstructFn = void(*)(void*);
-	using FDestructFn = void(*)(void*);
-	
 	bool IsValidIndex(FScriptSet* ScriptSet, int32 Index)
 	{
 		return ScriptSet->IsValidIndex(Index);
@@ -43,19 +39,43 @@ DECLARE_UNREALSHARP_BINDER(Bind_FScriptSet)
 		return ScriptSet->AddUninitialized(Property->SetLayout);
 	}
 
-	void Add(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, FGetKeyHash GetKeyHash, FEqualityFn EqualityFn, FConstructFn ConstructFn, FDestructFn DestructFn)
+	// Hashing and comparing through the element property directly, rather than calling back into C# for every probe.
+	void Add(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element)
 	{
-		ScriptSet->Add(Element, Property->SetLayout, GetKeyHash, EqualityFn, ConstructFn, DestructFn);
+		FScriptSetHelper Helper(Property, ScriptSet);
+		Helper.AddElement(Element);
 	}
 
-	int32 FindOrAdd(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, FGetKeyHash GetKeyHash, FEqualityFn EqualityFn, FConstructFn ConstructFn)
+	int32 FindOrAdd(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element)
 	{
-		return ScriptSet->FindOrAdd(Element, Property->SetLayout, GetKeyHash, EqualityFn, ConstructFn);
+		FProperty* ElementProp = Property->ElementProp;
+		
+		return ScriptSet->FindOrAdd(Element, Property->SetLayout,
+			[ElementProp](const void* Src) { return ElementProp->GetValueTypeHash(Src); },
+			[ElementProp](const void* A, const void* B) { return ElementProp->Identical(A, B); },
+			[ElementProp, Element](void* NewElement)
+			{
+				ElementProp->InitializeValue(NewElement);
+				ElementProp->CopySingleValue(NewElement, Element);
+			});
 	}
 
-	int FindIndex(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element, FGetKeyHash GetKeyHash, FEqualityFn EqualityFn)
+	int FindIndex(FScriptSet* ScriptSet, FSetProperty* Property, const void* Element)
 	{
-		return ScriptSet->FindIndex(Element, Property->SetLayout, GetKeyHash, EqualityFn);
+		FScriptSetHelper Helper(Property, ScriptSet);
+		return Helper.FindElementIndexFromHash(Element);
+	}
+
+	int32 GetEnumerationSnapshot(FScriptSet* ScriptSet, FSetProperty* Property, FCSSparseEnumerationSnapshot* OutSnapshot, uint32* AllocationFlags, int32 NumFlagWords)
+	{
+		OutSnapshot->Data = static_cast<uint8*>(ScriptSet->GetData(0, Property->SetLayout));
+		OutSnapshot->MaxIndex = ScriptSet->GetMaxIndex();
+		OutSnapshot->Num = ScriptSet->Num();
+		OutSnapshot->Stride = Property->SetLayout.Size;
+		OutSnapshot->KeyOffset = 0;
+		OutSnapshot->ValueOffset = 0;
+
+		return OutSnapshot->WriteAllocationFlags(AllocationFlags, NumFlagWords, [ScriptSet](int32 Index) { return ScriptSet->IsValidIndex(Index); });
 	}
 	
 	BIND_UNREALSHARP_FUNCTION(IsValidIndex)
@@ -68,4 +88,5 @@ DECLARE_UNREALSHARP_BINDER(Bind_FScriptSet)
 	BIND_UNREALSHARP_FUNCTION(Add)
 	BIND_UNREALSHARP_FUNCTION(FindOrAdd)
 	BIND_UNREALSHARP_FUNCTION(FindIndex)
+	BIND_UNREALSHARP_FUNCTION(GetEnumerationSnapshot)
 }
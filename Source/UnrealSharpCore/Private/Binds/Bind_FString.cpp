@@ -2,6 +2,29 @@
 
 DECLARE_UNREALSHARP_BINDER(Bind_FString)
 {
+	// Writes into the string's existing allocation when it's large enough. Where TCHAR is UTF-16 the managed characters are copied as is.
+	void AssignStringView(FString& NativeString, const UTF16CHAR* ManagedString, int32 Length)
+	{
+		if (!ManagedString || Length <= 0)
+		{
+			NativeString.Reset();
+			return;
+		}
+
+		// One extra for the terminator.
+		NativeString.Reset(Length + 1);
+
+		if constexpr (sizeof(TCHAR) == sizeof(UTF16CHAR))
+		{
+			NativeString.AppendChars(reinterpret_cast<const TCHAR*>(ManagedString), Length);
+		}
+		else
+		{
+			const auto Converted = StringCast<TCHAR>(ManagedString, Length);
+			NativeString.AppendChars(Converted.Get(), Converted.Length());
+		}
+	}
+	
 	void MarshalToNativeString(FString* NativeString, const char* ManagedString)
 	{
 		if (!NativeString)
@@ -29,17 +52,30 @@ DECLARE_UNREALSHARP_BINDER(Bind_FString)
 			return;
 		}
 
-		if (!ManagedString || Length <= 0)
+		// C# strings are UTF-16 (char*). Use a length-based view (no null-termination dependency) and convert to TCHAR correctly.
+		AssignStringView(*NativeString, ManagedString, Length);
+	}
+
+	// The managed side packs every string into one pooled buffer, Lengths holds the length of each of them.
+	void MarshalToNativeStringArray(TArray<FString>* NativeArray, const UTF16CHAR* PackedStrings, const int32* Lengths, int32 Count)
+	{
+		if (!NativeArray)
 		{
-			*NativeString = FString();
 			return;
 		}
 
-		// C# strings are UTF-16 (char*). Use a length-based view (no null-termination dependency) and convert to TCHAR correctly.
-		const auto Converted = StringCast<TCHAR>(ManagedString, Length);
-		*NativeString = FString(Converted.Length(), Converted.Get());
+		// Elements that are already there keep their allocations.
+		NativeArray->SetNum(Count, EAllowShrinking::No);
+
+		const UTF16CHAR* CurrentString = PackedStrings;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			AssignStringView((*NativeArray)[Index], CurrentString, Lengths[Index]);
+			CurrentString += Lengths[Index];
+		}
 	}
 	
 	BIND_UNREALSHARP_FUNCTION(MarshalToNativeString)
 	BIND_UNREALSHARP_FUNCTION(MarshalToNativeStringView)
+	BIND_UNREALSHARP_FUNCTION(MarshalToNativeStringArray)
 }
\ No newline at end of file
@@ -2,12 +2,21 @@
 
 DECLARE_UNREALSHARP_BINDER(Bind_FTypeBuilder)
 {
-	void RegisterManagedType_Native(TCHAR* InFieldName, TCHAR* InNamespace, TCHAR* InAssemblyName, TCHAR* NewJsonReflectionData, ECSFieldType FieldType, uint8* TypeHandle)
+	void RegisterManagedType_Native(TCHAR* InFieldName, TCHAR* InNamespace, TCHAR* InAssemblyName, TCHAR* NewJsonReflectionData, uint64 ConstructorHash, ECSFieldType FieldType, uint8* TypeHandle)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(UFTypeBuilderExporter::RegisterManagedType_Native);
 		UCSManagedAssembly* Assembly = UCSManager::Get().FindAssembly(InAssemblyName);
-		Assembly->RegisterManagedType(InFieldName, InNamespace, FieldType, TypeHandle, NewJsonReflectionData);
+		Assembly->RegisterManagedType(InFieldName, InNamespace, FieldType, TypeHandle, NewJsonReflectionData, ConstructorHash);
 	}
 	
 	BIND_UNREALSHARP_FUNCTION(RegisterManagedType_Native)
+
+	void RegisterManagedTypeFromBinary_Native(TCHAR* InFieldName, TCHAR* InNamespace, TCHAR* InAssemblyName, const uint8* ReflectionData, int32 ReflectionDataSize, uint64 ConstructorHash, ECSFieldType FieldType, uint8* TypeHandle)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UFTypeBuilderExporter::RegisterManagedTypeFromBinary_Native);
+		UCSManagedAssembly* Assembly = UCSManager::Get().FindAssembly(InAssemblyName);
+		Assembly->RegisterManagedType(InFieldName, InNamespace, FieldType, TypeHandle, ReflectionData, ReflectionDataSize, ConstructorHash);
+	}
+
+	BIND_UNREALSHARP_FUNCTION(RegisterManagedTypeFromBinary_Native)
 }
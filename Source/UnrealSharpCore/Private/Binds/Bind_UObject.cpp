@@ -10,8 +10,29 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 			return nullptr;
 		}
 		
+		// The managed counterpart is usually created by the constructor already, so this only reads its slot.
 		UObject* NewCSharpObject = NewObject<UObject>(Outer, Class, NAME_None, RF_NoFlags, Template);
-		return UCSManager::Get().FindManagedObject(NewCSharpObject);
+		return UCSManager::Get().FindManagedObjectHandle(NewCSharpObject).ManagedHandlePtr;
+	}
+
+	// Creates Count objects of the same class in one call and writes their managed handles to OutHandles.
+	int32 CreateNewObjects(UObject* Outer, UClass* Class, UObject* Template, int32 Count, void** OutHandles)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CreateNewObjects);
+
+		if (!IsValid(Outer) || !IsValid(Class) || Count <= 0)
+		{
+			return 0;
+		}
+
+		UCSManager& Manager = UCSManager::Get();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			UObject* NewCSharpObject = NewObject<UObject>(Outer, Class, NAME_None, RF_NoFlags, Template);
+			OutHandles[Index] = Manager.FindManagedObjectHandle(NewCSharpObject).ManagedHandlePtr;
+		}
+
+		return Count;
 	}
 
 	void* GetTransientPackage()
@@ -23,7 +44,7 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 			return nullptr;
 		}
 
-		return UCSManager::Get().FindManagedObject(TransientPackage);
+		return UCSManager::Get().FindManagedObjectHandle(TransientPackage).ManagedHandlePtr;
 	}
 
 	void NativeGetName(UObject* Object, FName* OutName)
@@ -31,63 +52,140 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 		*OutName = IsValid(Object) ? Object->GetFName() : NAME_None;
 	}
 	
-	void InvokeNativeFunctionOutParms(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+	enum class ECSNativeInvokePath : uint8
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(InvokeNativeFunctionOutParms);
-		
-		if (!NativeFunction->HasAnyFunctionFlags(FUNC_Native) && NativeFunction->HasAnyFunctionFlags(FUNC_Event))
+		ProcessEvent,
+		Invoke,
+		InvokeWithOutParms,
+	};
+
+	// Everything about a UFunction that the invoke path needs, resolved once instead of on every call.
+	struct FCSNativeCallPlan
+	{
+		TWeakObjectPtr<UFunction> Function;
+		FField* ChildProperties = nullptr;
+		ECSNativeInvokePath InvokePath = ECSNativeInvokePath::Invoke;
+		TArray<FProperty*, TInlineAllocator<4>> OutParms;
+
+		bool IsValidFor(const UFunction* NativeFunction) const
 		{
-			NativeObject->ProcessEvent(NativeFunction, Params);
+			return Function.Get() == NativeFunction && ChildProperties == NativeFunction->ChildProperties;
 		}
-		else
-		{
-			FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
-			FOutParmRec** LastOut = &NewStack.OutParms;
+	};
 
-			for (TFieldIterator<FProperty> PropIt(NativeFunction); PropIt; ++PropIt)
-			{
-				FProperty* Property = *PropIt;
+	void BuildCallPlan(UFunction* NativeFunction, FCSNativeCallPlan& OutPlan)
+	{
+		OutPlan.Function = NativeFunction;
+		OutPlan.ChildProperties = NativeFunction->ChildProperties;
+		OutPlan.OutParms.Reset();
 
-				if (!Property->HasAllPropertyFlags(CPF_OutParm))
-				{
-					continue;
-				}
+		const EFunctionFlags FunctionFlags = NativeFunction->FunctionFlags;
 
-				FOutParmRec* Out = static_cast<FOutParmRec*>(UE_VSTACK_ALLOC(VirtualStackAllocator, sizeof(FOutParmRec)));
+	    //if the function is an event and not native we would go through UObject::ProcessEvent to avoid stack corruption since it will call into BP code
+		if (!(FunctionFlags & FUNC_Native) && FunctionFlags & FUNC_Event)
+		{
+			OutPlan.InvokePath = ECSNativeInvokePath::ProcessEvent;
+			return;
+		}
 
-				Out->PropAddr = Property->ContainerPtrToValuePtr<uint8>(Params);
-				Out->Property = Property;
-				
-				*LastOut = Out;
-				LastOut  = &Out->NextOutParm;
+		for (TFieldIterator<FProperty> PropIt(NativeFunction); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+
+			if (Property->HasAllPropertyFlags(CPF_OutParm))
+			{
+				OutPlan.OutParms.Add(Property);
 			}
-			
-			*LastOut = nullptr;
-			NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
 		}
+
+	    //if the function is native we can go through the fast path. it could also contain the event flag which is common for u# functions
+		OutPlan.InvokePath = OutPlan.OutParms.IsEmpty() ? ECSNativeInvokePath::Invoke : ECSNativeInvokePath::InvokeWithOutParms;
 	}
 
-	void EvaluateInvokePath(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+	// Plans are only cached for calls on the game thread, other threads build a throwaway plan per call.
+	// Entries are checked against the function they were built for, so reinstanced functions just rebuild theirs.
+	FCSNativeCallPlan& FindOrBuildCallPlan(UFunction* NativeFunction, FCSNativeCallPlan& ScratchPlan)
 	{
-		const EFunctionFlags FunctionFlags = NativeFunction->FunctionFlags;
-
-		if (FunctionFlags & FUNC_HasOutParms)
+		if (!IsInGameThread())
 		{
-			InvokeNativeFunctionOutParms(NativeObject, NativeFunction, Params, ReturnValueAddress);
+			BuildCallPlan(NativeFunction, ScratchPlan);
+			return ScratchPlan;
 		}
-	    //if the function is an event and not native we would go through UObject::ProcessEvent to avoid stack corruption since it will call into BP code
-		else if (!(FunctionFlags & FUNC_Native) && FunctionFlags & FUNC_Event)
+
+		static TMap<const UFunction*, FCSNativeCallPlan> CallPlans;
+		static FDelegateHandle PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]
 		{
-			NativeObject->ProcessEvent(NativeFunction, Params);
+			for (auto It = CallPlans.CreateIterator(); It; ++It)
+			{
+				if (!It.Value().Function.IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+		});
+
+		FCSNativeCallPlan& Plan = CallPlans.FindOrAdd(NativeFunction);
+		if (!Plan.IsValidFor(NativeFunction))
+		{
+			BuildCallPlan(NativeFunction, Plan);
 		}
-	    //if the function is native we can go through the fast path. it could also contain the event flag which is common for u# functions
-		else
+
+		return Plan;
+	}
+
+	void ExecuteCallPlan(const FCSNativeCallPlan& Plan, UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+	{
+		switch (Plan.InvokePath)
 		{
-			FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
-			NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
+		case ECSNativeInvokePath::ProcessEvent:
+			{
+				NativeObject->ProcessEvent(NativeFunction, Params);
+				break;
+			}
+		case ECSNativeInvokePath::Invoke:
+			{
+				FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
+				NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
+				break;
+			}
+		case ECSNativeInvokePath::InvokeWithOutParms:
+			{
+				FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
+
+				// Only the addresses differ between calls, so the records are just filled in on the stack.
+				const int32 NumOutParms = Plan.OutParms.Num();
+				FOutParmRec* OutParms = static_cast<FOutParmRec*>(FMemory_Alloca(NumOutParms * sizeof(FOutParmRec)));
+
+				for (int32 Index = 0; Index < NumOutParms; ++Index)
+				{
+					FProperty* Property = Plan.OutParms[Index];
+					FOutParmRec& Out = OutParms[Index];
+
+					Out.PropAddr = Property->ContainerPtrToValuePtr<uint8>(Params);
+					Out.Property = Property;
+					Out.NextOutParm = Index + 1 < NumOutParms ? &OutParms[Index + 1] : nullptr;
+				}
+
+				NewStack.OutParms = OutParms;
+				NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
+				break;
+			}
 		}
 	}
 
+	void EvaluateInvokePath(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+	{
+		FCSNativeCallPlan ScratchPlan;
+		const FCSNativeCallPlan& Plan = FindOrBuildCallPlan(NativeFunction, ScratchPlan);
+		ExecuteCallPlan(Plan, NativeObject, NativeFunction, Params, ReturnValueAddress);
+	}
+
+	void InvokeNativeFunctionOutParms(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(InvokeNativeFunctionOutParms);
+		EvaluateInvokePath(NativeObject, NativeFunction, Params, ReturnValueAddress);
+	}
+
 	void InvokeNativeFunction(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(InvokeNativeFunction);
@@ -97,6 +195,8 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 	void InvokeNativeStaticFunction(UClass* NativeClass, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(InvokeNativeStaticFunction);
+
+		// Resolved before the plan lookup, creating the CDO can run code that adds plans and moves the cached ones.
 		UObject* ClassDefaultObject = NativeClass->GetDefaultObject();
 		EvaluateInvokePath(ClassDefaultObject, NativeFunction, Params, ReturnValueAddress);
 	}
@@ -139,7 +239,7 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 		}
 
 		UWorld* World = Object->GetWorld();
-		return UCSManager::Get().FindManagedObject(World);
+		return IsValid(World) ? UCSManager::Get().FindManagedObjectHandle(World).ManagedHandlePtr : nullptr;
 	}
 	
 	bool IsA(const UObject* Object, UClass* Class)
@@ -161,7 +261,7 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 		}
 
 		UObject* Outer = Object->GetOuter();
-		return UCSManager::Get().FindManagedObject(Outer);
+		return IsValid(Outer) ? UCSManager::Get().FindManagedObjectHandle(Outer).ManagedHandlePtr : nullptr;
 	}
 
 	void* StaticLoadClass(UClass* BaseClass, UObject* InOuter, const char* Name)
@@ -176,7 +276,7 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 		{
 			return nullptr;
 		}
-		return UCSManager::Get().FindManagedObject(Loaded);
+		return UCSManager::Get().FindManagedObjectHandle(Loaded).ManagedHandlePtr;
 	}
 
 	void* StaticLoadObject(UClass* BaseClass, UObject* InOuter, const char* Name)
@@ -191,7 +291,7 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 		{
 			return nullptr;
 		}
-		return UCSManager::Get().FindManagedObject(LoadedObj);
+		return UCSManager::Get().FindManagedObjectHandle(LoadedObj).ManagedHandlePtr;
 	}
 
 	bool ImplementsInterface(UObject* Object, UClass* InterfaceClass)
@@ -202,6 +302,7 @@ DECLARE_UNREALSHARP_BINDER(Bind_UObject)
 	}
 	
 	BIND_UNREALSHARP_FUNCTION(CreateNewObject)
+	BIND_UNREALSHARP_FUNCTION(CreateNewObjects)
 	BIND_UNREALSHARP_FUNCTION(GetTransientPackage)
 	BIND_UNREALSHARP_FUNCTION(NativeGetName)
 	BIND_UNREALSHARP_FUNCTION(InvokeNativeFunction)
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// SparseEnumerator.cs reads the element count straight from the container to detect modifications while enumerating.
+static_assert(sizeof(FScriptSparseArray) == sizeof(FScriptArray) + sizeof(FScriptBitArray) + 2 * sizeof(int32), "FScriptSparseArray layout changed, update ScriptSparseArray in SparseEnumerator.cs");
+static_assert(!PLATFORM_64BITS || sizeof(FScriptBitArray) == 32, "FScriptBitArray layout changed, update ScriptSparseArray in SparseEnumerator.cs");
+
+// Everything managed code needs to walk the elements of a TMap or TSet in place, gathered in a single call.
+// Only valid until the container is next modified.
+struct FCSSparseEnumerationSnapshot
+{
+	uint8* Data = nullptr;
+	int32 MaxIndex = 0;
+	int32 Num = 0;
+	int32 Stride = 0;
+	int32 KeyOffset = 0;
+	int32 ValueOffset = 0;
+
+	// Writes one bit per index below MaxIndex if the bitmap fits in NumFlagWords, and returns how many words it needs.
+	template<typename IsValidIndexFunc>
+	int32 WriteAllocationFlags(uint32* AllocationFlags, int32 NumFlagWords, IsValidIndexFunc&& IsValidIndex) const
+	{
+		const int32 NumRequiredWords = FMath::DivideAndRoundUp(MaxIndex, 32);
+		if (NumRequiredWords > NumFlagWords)
+		{
+			return NumRequiredWords;
+		}
+
+		FMemory::Memzero(AllocationFlags, NumRequiredWords * sizeof(uint32));
+
+		for (int32 Index = 0; Index < MaxIndex; ++Index)
+		{
+			if (IsValidIndex(Index))
+			{
+				AllocationFlags[Index >> 5] |= 1u << (Index & 31);
+			}
+		}
+
+		return NumRequiredWords;
+	}
+};
@@ -23,3 +23,9 @@ bool FCSFieldName::Serialize(FConstObject JsonObject)
 	CALL_SERIALIZE(Namespace.Serialize(JsonObject));	
 	END_JSON_SERIALIZE
 }
+
+void FCSFieldName::Serialize(FArchive& Ar)
+{
+	Ar << Name;
+	Namespace.Serialize(Ar);
+}
@@ -10,6 +10,8 @@
 #include "Compilers/CSManagedDelegateCompiler.h"
 #include "Utilities/CSClassUtilities.h"
 #include "Utilities/CSUtilities.h"
+#include "Async/ParallelFor.h"
+#include "Factories/CSPropertyFactory.h"
 
 FCSAssemblyEvents::FCSAssemblyEvent FCSAssemblyEvents::OnAssemblyLoaded;
 FCSAssemblyEvents::FCSAssemblyEvent FCSAssemblyEvents::OnAssemblyUnloaded;
@@ -43,14 +45,24 @@ bool UCSManagedAssembly::LoadAssembly()
 		return true;
 	}
 
-	if (!FPaths::FileExists(AssemblyFilePath))
+	// Assemblies from the load order manifests are preloaded on worker threads by UCSManager.
+	// A failed preload was already reported, a later load (after a rebuild) tries again.
+	if (bPreloadFailed)
+	{
+		bPreloadFailed = false;
+		return false;
+	}
+	
+	if (!bIsPreloaded && !PreloadAssembly())
 	{
-		UE_LOGFMT(LogUnrealSharp, Error, "Assembly path does not exist: {0}", AssemblyFilePath);
 		return false;
 	}
 
-	bIsLoading = true;
+	bIsPreloaded = false;
 
+	// Phase one: the managed side loads the assembly and its generated registrars register every type, which only collects the raw reflection data.
+	// The assembly is already loaded at this point, this only runs its module initializers and starts its modules.
+	const double StartTime = FPlatformTime::Seconds();
 	FGCHandle NewAssemblyGCHandle = GetManagedPluginCallbacks().LoadPlugin(*AssemblyFilePath, bIsCollectible);
 
 	if (NewAssemblyGCHandle.IsNull())
@@ -59,17 +71,41 @@ bool UCSManagedAssembly::LoadAssembly()
 	}
 	
 	AssemblyHandle = MakeShared<FGCHandle>(NewAssemblyGCHandle);
+	
+	const int32 NumRegisteredTypes = PendingTypeRegistrations.Num();
+	const double CollectTime = FPlatformTime::Seconds();
+
+	// Phase two: deserialize the reflection data on worker threads, it doesn't touch any UObjects.
+	DeserializePendingTypes();
+	const double DeserializeTime = FPlatformTime::Seconds();
 
+	// Phase three: create and compile the UFields on the game thread.
+	CreatePendingTypes();
+	
 	for (const TSharedPtr<FCSManagedTypeDefinition>& QueuedType : PendingCompilationTypes)
 	{
 		QueuedType->Compile();
 	}
+	
+	const double CompileTime = FPlatformTime::Seconds();
+	UE_LOGFMT(LogUnrealSharp, Log, "Loaded {0} with {1} registered types. Preload: {2} ms, load and collect: {3} ms, deserialize: {4} ms, create and compile: {5} ms",
+		GetName(), NumRegisteredTypes,
+		PreloadTime * 1000.0,
+		(CollectTime - StartTime) * 1000.0,
+		(DeserializeTime - CollectTime) * 1000.0,
+		(CompileTime - DeserializeTime) * 1000.0);
 
 #if WITH_EDITOR
 	PendingCompilationTypes.Reset();
 #else
 	PendingCompilationTypes.Empty();
 #endif
+
+	if (ReflectionDataCache.IsValid())
+	{
+		ReflectionDataCache->Save();
+		ReflectionDataCache.Reset();
+	}
 	
 	bIsLoading = false;
 	
@@ -77,6 +113,42 @@ bool UCSManagedAssembly::LoadAssembly()
 	return true;
 }
 
+bool UCSManagedAssembly::PreloadAssembly()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSManagedAssembly::PreloadAssembly: ") + GetName()));
+
+	if (!FPaths::FileExists(AssemblyFilePath))
+	{
+		UE_LOGFMT(LogUnrealSharp, Error, "Assembly path does not exist: {0}", AssemblyFilePath);
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	bIsLoading = true;
+
+	if (bUseReflectionDataCache)
+	{
+		ReflectionDataCache = MakeUnique<FCSReflectionDataCache>(AssemblyFilePath);
+		ReflectionDataCache->Load();
+	}
+
+	// Types registered from here only queue their reflection data, RegisterManagedType must not touch any UObjects.
+	if (!GetManagedPluginCallbacks().PreloadPlugin(*AssemblyFilePath, bIsCollectible))
+	{
+		UE_LOGFMT(LogUnrealSharp, Error, "Failed to preload assembly: {0}", AssemblyFilePath);
+		
+		PendingTypeRegistrations.Reset();
+		ReflectionDataCache.Reset();
+		bIsLoading = false;
+		bPreloadFailed = true;
+		return false;
+	}
+
+	PreloadTime = FPlatformTime::Seconds() - StartTime;
+	bIsPreloaded = true;
+	return true;
+}
+
 void UCSManagedAssembly::UnloadAssembly()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSManagedAssembly::UnloadAssembly: ") + GetName()));
@@ -93,11 +165,22 @@ void UCSManagedAssembly::UnloadAssembly()
 		return;
 	}
 	
+	// Objects deleted since the last garbage collection may still hold handles into this assembly.
+	UCSManager::Get().FlushPendingHandleDisposals();
+	
 	FGCHandleIntPtr AssemblyHandlePtr = AssemblyHandle->GetHandle();
 	for (TSharedPtr<FGCHandle> Handle : ManagedHandles)
 	{
 		Handle->Dispose(AssemblyHandlePtr);
 	}
+
+	TArray<FGCHandleIntPtr> ObjectHandles;
+	UCSManager::Get().GetManagedObjectHandles().RemoveAll(this, ObjectHandles);
+	
+	for (FGCHandleIntPtr ObjectHandle : ObjectHandles)
+	{
+		FGCHandle(ObjectHandle).Dispose(AssemblyHandlePtr);
+	}
 	
 	ManagedTypeHandles.Reset();
 	ManagedHandles.Reset();
@@ -139,26 +222,34 @@ TSharedPtr<FGCHandle> UCSManagedAssembly::AddTypeHandle(const FCSFieldName& Fiel
 	return NewTypeHandle;
 }
 
-TSharedPtr<FGCHandle> UCSManagedAssembly::FindMethodHandle(const TSharedPtr<FGCHandle>& TypeHandle, const FString& MethodName)
+int32 UCSManagedAssembly::FindMethodHandles(const TSharedPtr<FGCHandle>& TypeHandle, TConstArrayView<const TCHAR*> FunctionNames, TArrayView<TSharedPtr<FGCHandle>> OutMethodHandles, TArrayView<void*> OutUnmanagedInvokers)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::GetManagedMethod);
-	UE_LOGFMT(LogUnrealSharp, Verbose, "Looking up managed method {0}", MethodName);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::FindMethodHandles);
+	check(FunctionNames.Num() == OutMethodHandles.Num() && FunctionNames.Num() == OutUnmanagedInvokers.Num());
 	
 	if (!TypeHandle.IsValid())
 	{
-		UE_LOGFMT(LogUnrealSharp, Error, "Type handle is invalid for method {0}", MethodName);
-		return nullptr;
+		UE_LOGFMT(LogUnrealSharp, Error, "Type handle is invalid for {0} methods", FunctionNames.Num());
+		return 0;
 	}
 
-	uint8* MethodHandle = GetManagedCallbacks().GetManagedMethod(TypeHandle->GetPointer(), *MethodName);
+	TArray<uint8*, TInlineAllocator<32>> MethodHandles;
+	MethodHandles.SetNumZeroed(FunctionNames.Num());
+	
+	const int32 NumFound = GetManagedCallbacks().GetManagedMethods(TypeHandle->GetPointer(), FunctionNames.GetData(), FunctionNames.Num(), MethodHandles.GetData(), OutUnmanagedInvokers.GetData());
 
-	if (!MethodHandle)
+	for (int32 Index = 0; Index < FunctionNames.Num(); ++Index)
 	{
-		UE_LOGFMT(LogUnrealSharp, Error, "Failed to find managed method for {0}", MethodName);
-		return nullptr;
+		if (!MethodHandles[Index])
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "Failed to find managed method for Invoke_{0}", FunctionNames[Index]);
+			continue;
+		}
+		
+		OutMethodHandles[Index] = ManagedHandles.Emplace_GetRef(MakeShared<FGCHandle>(MethodHandles[Index]));
 	}
 	
-	return ManagedHandles.Emplace_GetRef(MakeShared<FGCHandle>(MethodHandle));
+	return NumFound;
 }
 
 TSharedPtr<FCSManagedTypeDefinition> UCSManagedAssembly::FindOrAddManagedTypeDefinition(UClass* Field)
@@ -194,47 +285,189 @@ TSharedPtr<FCSManagedTypeDefinition> UCSManagedAssembly::FindOrAddManagedTypeDef
 	return ManagedTypeDefinition;
 }
 
-void UCSManagedAssembly::RegisterManagedType(TCHAR* InFieldName, const TCHAR* InNamespace, ECSFieldType FieldType, uint8* TypeGCHandle, TCHAR* ReflectionJsonString)
+void UCSManagedAssembly::RegisterManagedType(TCHAR* InFieldName, const TCHAR* InNamespace, ECSFieldType FieldType, uint8* TypeGCHandle, TCHAR* ReflectionJsonString, uint64 ConstructorHash)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::RegisterManagedType);
+	UE_LOGFMT(LogUnrealSharp, Verbose, "Registering type {0}.{1} from JSON", InNamespace, InFieldName);
+
+	FCSPendingTypeRegistration Registration;
+	Registration.FieldName = FCSFieldName(InFieldName, InNamespace);
+	Registration.TypeGCHandle = TypeGCHandle;
+	Registration.FieldType = FieldType;
+	Registration.StructuralHash = FCSTypeReferenceReflectionData::HashJsonString(ReflectionJsonString);
+	Registration.ConstructorHash = ConstructorHash;
+
+	// The string is only pinned for the duration of this call.
+	if (PrepareTypeRegistration(Registration))
+	{
+		Registration.JsonReflectionData = ReflectionJsonString;
+	}
+
+	QueueTypeRegistration(MoveTemp(Registration));
+}
+
+void UCSManagedAssembly::RegisterManagedType(TCHAR* InFieldName, const TCHAR* InNamespace, ECSFieldType FieldType, uint8* TypeGCHandle, const uint8* ReflectionData, int32 ReflectionDataSize, uint64 ConstructorHash)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::RegisterManagedType);
 	UE_LOGFMT(LogUnrealSharp, Verbose, "Registering type {0}.{1}", InNamespace, InFieldName);
-	
-	const FCSFieldName FieldName(InFieldName, InNamespace);
-	TSharedPtr<FCSManagedTypeDefinition>& ManagedTypeDefinition = ManagedTypeRegistry.FindOrAdd(FieldName);
+
+	FCSPendingTypeRegistration Registration;
+	Registration.FieldName = FCSFieldName(InFieldName, InNamespace);
+	Registration.TypeGCHandle = TypeGCHandle;
+	Registration.FieldType = FieldType;
+	Registration.ConstructorHash = ConstructorHash;
+
+	if (!ReadBinaryJsonHash(ReflectionData, ReflectionDataSize, Registration.StructuralHash))
+	{
+		UE_LOGFMT(LogUnrealSharp, Fatal, "Invalid binary reflection data for type {0}.{1}", InNamespace, InFieldName);
+	}
+
+	if (PrepareTypeRegistration(Registration))
+	{
+		Registration.BinaryReflectionData = TArray<uint8>(ReflectionData, ReflectionDataSize);
+	}
+
+	QueueTypeRegistration(MoveTemp(Registration));
+}
+
+bool UCSManagedAssembly::PrepareTypeRegistration(FCSPendingTypeRegistration& Registration)
+{
+	Registration.ChangedFlags = StructuralChanges;
 
 #if WITH_EDITOR
-	if (ManagedTypeDefinition.IsValid() && !FCSUtilities::ShouldReloadDefinition(ManagedTypeDefinition.ToSharedRef(), ReflectionJsonString))
+	// Registration may run on a preload worker, so existing definitions are only read here and updated in CreatePendingTypes.
+	const TSharedPtr<FCSManagedTypeDefinition>* ManagedTypeDefinition = ManagedTypeRegistry.Find(Registration.FieldName);
+	if (ManagedTypeDefinition && ManagedTypeDefinition->IsValid())
 	{
-		ManagedTypeDefinition->SetTypeGCHandle(TypeGCHandle);
-		ManagedTypeDefinition->SetDirtyFlags(None);
-		return;
+		Registration.ChangedFlags = FCSUtilities::GetStructuralChanges(ManagedTypeDefinition->ToSharedRef(), Registration.StructuralHash, Registration.ConstructorHash);
+		
+		if (!EnumHasAnyFlags(Registration.ChangedFlags, StructuralChanges))
+		{
+			// The reflection data is identical, keep it and only recompile if the constructor changed.
+			Registration.bKeepReflectionData = true;
+			return false;
+		}
 	}
 #endif
-	
-	UCSManagedTypeCompiler* Compiler = FCSUtilities::ResolveCompilerFromFieldType(FieldType);
-	TSharedPtr<FCSTypeReferenceReflectionData> NewReflectionData = Compiler->CreateReflectionData();
-	NewReflectionData->SerializeFromJsonString(ReflectionJsonString);
 
-	if (ManagedTypeDefinition.IsValid())
+	return true;
+}
+
+void UCSManagedAssembly::QueueTypeRegistration(FCSPendingTypeRegistration&& Registration)
+{
+	PendingTypeRegistrations.Add(MoveTemp(Registration));
+
+	// Types are normally registered by the generated registrars while LoadAssembly is running, which processes them all at once.
+	if (!bIsLoading)
+	{
+		DeserializePendingTypes();
+		CreatePendingTypes();
+	}
+}
+
+void UCSManagedAssembly::DeserializePendingTypes()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::DeserializePendingTypes);
+
+	if (PendingTypeRegistrations.IsEmpty())
 	{
-		ManagedTypeDefinition->SetReflectionData(NewReflectionData);
+		return;
 	}
-	else
+
+	// Property generators are looked up while deserializing and are lazily gathered from UObjects.
+	FCSPropertyFactory::EnsureInitialized();
+
+	// Resolved here rather than on registration, which may run on a worker thread.
+	for (FCSPendingTypeRegistration& Registration : PendingTypeRegistrations)
 	{
-		ManagedTypeDefinition = FCSManagedTypeDefinition::CreateFromReflectionData(NewReflectionData, this, Compiler);
+		Registration.Compiler = FCSUtilities::ResolveCompilerFromFieldType(Registration.FieldType);
 	}
-	
-	ManagedTypeDefinition->SetTypeGCHandle(TypeGCHandle);
+
+	ParallelFor(PendingTypeRegistrations.Num(), [this](int32 Index)
+	{
+		FCSPendingTypeRegistration& Registration = PendingTypeRegistrations[Index];
+		if (Registration.bKeepReflectionData)
+		{
+			return;
+		}
+		
+		Registration.ReflectionData = Registration.Compiler->CreateReflectionData();
+
+		if (ReflectionDataCache.IsValid())
+		{
+			if (ReflectionDataCache->Read(Registration.FieldName, Registration.StructuralHash, *Registration.ReflectionData))
+			{
+				return;
+			}
+
+			// A partially read entry may have left data behind.
+			Registration.ReflectionData = Registration.Compiler->CreateReflectionData();
+		}
+
+		if (!Registration.BinaryReflectionData.IsEmpty())
+		{
+			Registration.ReflectionData->SerializeFromBinary(Registration.BinaryReflectionData.GetData(), Registration.BinaryReflectionData.Num());
+		}
+		else
+		{
+			Registration.ReflectionData->SerializeFromJsonString(Registration.JsonReflectionData.GetCharArray().GetData());
+		}
+
+		if (ReflectionDataCache.IsValid())
+		{
+			Registration.CachedReflectionData = FCSReflectionDataCache::SerializeReflectionData(*Registration.ReflectionData);
+		}
+	});
+
+	if (ReflectionDataCache.IsValid())
+	{
+		for (FCSPendingTypeRegistration& Registration : PendingTypeRegistrations)
+		{
+			if (!Registration.CachedReflectionData.IsEmpty())
+			{
+				ReflectionDataCache->Add(Registration.FieldName, Registration.StructuralHash, MoveTemp(Registration.CachedReflectionData));
+			}
+		}
+	}
+}
+
+void UCSManagedAssembly::CreatePendingTypes()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::CreatePendingTypes);
+
+	for (FCSPendingTypeRegistration& Registration : PendingTypeRegistrations)
+	{
+		TSharedPtr<FCSManagedTypeDefinition>& ManagedTypeDefinition = ManagedTypeRegistry.FindOrAdd(Registration.FieldName);
+
+		if (Registration.bKeepReflectionData)
+		{
+			ManagedTypeDefinition->SetDirtyFlags(Registration.ChangedFlags);
+		}
+		else if (ManagedTypeDefinition.IsValid())
+		{
+			ManagedTypeDefinition->SetReflectionData(Registration.ReflectionData);
+			ManagedTypeDefinition->SetDirtyFlags(Registration.ChangedFlags);
+		}
+		else
+		{
+			ManagedTypeDefinition = FCSManagedTypeDefinition::CreateFromReflectionData(Registration.ReflectionData, this, Registration.Compiler);
+		}
+
+		ManagedTypeDefinition->SetHashes(Registration.StructuralHash, Registration.ConstructorHash);
+		ManagedTypeDefinition->SetTypeGCHandle(Registration.TypeGCHandle);
+	}
+
+	PendingTypeRegistrations.Reset();
 }
 
-TSharedPtr<FGCHandle> UCSManagedAssembly::CreateManagedObjectFromNative(const UObject* Object)
+FGCHandle UCSManagedAssembly::CreateManagedObjectFromNative(const UObject* Object)
 {
 	UClass* Class = FCSClassUtilities::GetFirstNonBlueprintClass(Object->GetClass());
 	TSharedPtr<FCSManagedTypeDefinition> ManagedTypeDefinition = FindOrAddManagedTypeDefinition(Class);
 	return CreateManagedObjectFromNative(Object, ManagedTypeDefinition->GetTypeGCHandle());
 }
 
-TSharedPtr<FGCHandle> UCSManagedAssembly::CreateManagedObjectFromNative(const UObject* Object, const TSharedPtr<FGCHandle>& TypeGCHandle)
+FGCHandle UCSManagedAssembly::CreateManagedObjectFromNative(const UObject* Object, const TSharedPtr<FGCHandle>& TypeGCHandle)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManagedAssembly::CreateManagedObjectFromNative);
 	
@@ -246,12 +479,8 @@ TSharedPtr<FGCHandle> UCSManagedAssembly::CreateManagedObjectFromNative(const UO
 		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to create managed counterpart for {0}:\n{1}", Object->GetName(), Error);
 	}
 
-	TSharedPtr<FGCHandle> Handle = MakeShared<FGCHandle>(NewObjectHandle);
-
-	const FCSObjectID ObjectID = Object->GetUniqueID();
-	UCSManager::Get().GetManagedObjectHandles().AddByHash(ObjectID.Get(), ObjectID, Handle);
-	ManagedHandles.Add(Handle);
-	return Handle;
+	UCSManager::Get().GetManagedObjectHandles().Add(Object->GetUniqueID(), NewObjectHandle.GetHandle(), this);
+	return NewObjectHandle;
 }
 
 TSharedPtr<FGCHandle> UCSManagedAssembly::GetOrCreateManagedInterface(UObject* Object, UClass* InterfaceClass)
@@ -271,13 +500,14 @@ TSharedPtr<FGCHandle> UCSManagedAssembly::GetOrCreateManagedInterface(UObject* O
 		return *Existing;
 	}
 
-	TSharedPtr<FGCHandle>* ObjectHandle = UCSManager::Get().GetManagedObjectHandles().FindByHash(ObjectID.Get(), ObjectID);
-	if (!ObjectHandle)
+	// Objects of lazy classes may not have their counterpart yet.
+	const FGCHandleIntPtr ObjectHandle = UCSManager::Get().FindManagedObjectHandle(Object);
+	if (!ObjectHandle.ManagedHandlePtr)
 	{
 		return nullptr;
 	}
     
-	FGCHandle NewManagedObjectWrapper = GetManagedCallbacks().CreateNewManagedObjectWrapper((*ObjectHandle)->GetPointer(), TypeHandle->GetPointer());
+	FGCHandle NewManagedObjectWrapper = GetManagedCallbacks().CreateNewManagedObjectWrapper(ObjectHandle.ManagedHandlePtr, TypeHandle->GetPointer());
 	
 	if (NewManagedObjectWrapper.IsNull())
 	{
@@ -21,9 +21,12 @@ void FCSManagedDelegate::Invoke(UObject* WorldContextObject, bool bDispose)
 		WorldContext = World ? World : WorldContextObject;
 	}
 
+	UCSManager& Manager = UCSManager::Get();
+	Manager.FlushPendingHandleDisposalsBeforeManagedCall();
+
 	if (WorldContext)
 	{
-		UCSManager::Get().SetCurrentWorldContext(WorldContext);
+		Manager.SetCurrentWorldContext(WorldContext);
 	}
 
 	GetManagedCallbacks().InvokeDelegate(CallbackHandle.GetHandle());
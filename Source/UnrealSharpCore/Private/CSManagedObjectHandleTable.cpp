@@ -0,0 +1,93 @@
+#include "CSManagedObjectHandleTable.h"
+
+FCSManagedObjectHandleTable::~FCSManagedObjectHandleTable()
+{
+	for (FCSManagedObjectSlot* Chunk : Chunks)
+	{
+		FMemory::Free(Chunk);
+	}
+}
+
+void FCSManagedObjectHandleTable::Initialize(int32 MaxObjects)
+{
+	check(Chunks.IsEmpty());
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(FMath::Max(MaxObjects, 1), NumElementsPerChunk);
+	Chunks.SetNumZeroed(NumChunks);
+	ManagedBits.SetNumZeroed(FMath::DivideAndRoundUp(FMath::Max(MaxObjects, 1), 64));
+}
+
+void FCSManagedObjectHandleTable::Add(int32 Index, FGCHandleIntPtr Handle, UCSManagedAssembly* OwningAssembly)
+{
+	FCSManagedObjectSlot& Slot = GetOrAddSlot(Index);
+	Slot.Handle = Handle;
+	Slot.OwningAssembly = OwningAssembly;
+
+	// Objects can be constructed on the async loading thread, so the bit is set atomically as well.
+	FPlatformAtomics::InterlockedOr(&ManagedBits[Index / 64], int64(1) << (Index % 64));
+}
+
+bool FCSManagedObjectHandleTable::Remove(int32 Index, FCSManagedObjectSlot& OutSlot)
+{
+	FCSManagedObjectSlot* Slot = const_cast<FCSManagedObjectSlot*>(GetSlot(Index));
+	if (!Slot || Slot->IsEmpty())
+	{
+		return false;
+	}
+
+	OutSlot = *Slot;
+	*Slot = FCSManagedObjectSlot();
+	return true;
+}
+
+void FCSManagedObjectHandleTable::RemoveAll(const UCSManagedAssembly* OwningAssembly, TArray<FGCHandleIntPtr>& OutHandles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedObjectHandleTable::RemoveAll);
+
+	for (FCSManagedObjectSlot* Chunk : Chunks)
+	{
+		if (!Chunk)
+		{
+			continue;
+		}
+
+		for (int32 i = 0; i < NumElementsPerChunk; ++i)
+		{
+			FCSManagedObjectSlot& Slot = Chunk[i];
+			if (Slot.IsEmpty() || Slot.OwningAssembly != OwningAssembly)
+			{
+				continue;
+			}
+
+			OutHandles.Add(Slot.Handle);
+			Slot = FCSManagedObjectSlot();
+		}
+	}
+}
+
+FCSManagedObjectSlot& FCSManagedObjectHandleTable::GetOrAddSlot(int32 Index)
+{
+	const int32 ChunkIndex = Index / NumElementsPerChunk;
+	checkf(Chunks.IsValidIndex(ChunkIndex), TEXT("Object index %d is outside of the managed handle table. Was the table initialized?"), Index);
+
+	FCSManagedObjectSlot* Chunk = Chunks[ChunkIndex];
+	if (!Chunk)
+	{
+		// Objects can be constructed on the async loading thread, so publish new chunks atomically.
+		const SIZE_T ChunkSize = sizeof(FCSManagedObjectSlot) * NumElementsPerChunk;
+		FCSManagedObjectSlot* NewChunk = static_cast<FCSManagedObjectSlot*>(FMemory::MallocZeroed(ChunkSize));
+
+		FCSManagedObjectSlot* ExistingChunk = static_cast<FCSManagedObjectSlot*>(FPlatformAtomics::InterlockedCompareExchangePointer(reinterpret_cast<void**>(&Chunks[ChunkIndex]), NewChunk, nullptr));
+		if (ExistingChunk)
+		{
+			FMemory::Free(NewChunk);
+			Chunk = ExistingChunk;
+		}
+		else
+		{
+			Chunk = NewChunk;
+		}
+	}
+
+	return Chunk[Index % NumElementsPerChunk];
+}
@@ -11,6 +11,8 @@
 #include "Utilities/CSClassUtilities.h"
 
 #include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Tasks/Task.h"
 #include "UObject/Package.h"
 
 #ifdef __clang__
@@ -61,11 +63,15 @@ UCSManagedAssembly* FindOwningAssemblyGeneric(UField* Object, TMap<FCSObjectID,
 
 UCSManager* UCSManager::Instance = nullptr;
 
+TRACE_DECLARE_INT_COUNTER(UnrealSharp_DisposedHandles, TEXT("UnrealSharp/DisposedHandles"));
+
 void UCSManager::Initialize()
 {
 	GlobalManagedPackage = FindOrAddManagedPackage(FCSNamespace(TEXT("UnrealSharp")));
+	ManagedObjectHandles.Initialize(GUObjectArray.GetObjectArrayCapacity());
 	
 	FCoreDelegates::OnPreExit.AddUObject(this, &UCSManager::OnEnginePreExit);
+	FCoreUObjectDelegates::GetPostPurgeGarbageDelegate().AddUObject(this, &UCSManager::FlushPendingHandleDisposals);
 	GUObjectArray.AddUObjectDeleteListener(this);
 	
 	InitialAssemblyLoad();
@@ -76,18 +82,22 @@ void UCSManager::Initialize()
 
 void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 {
+	// Most deleted objects never had a managed counterpart. Interface wrappers are only created for objects that have one,
+	// so checking the bit covers those as well.
+	if (!ManagedObjectHandles.ConsumeManagedBit(Index))
+	{
+		return;
+	}
+	
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::NotifyUObjectDeleted);
 	
-	FCSObjectID ObjectID(Index);
-
-	TSharedPtr<FGCHandle> Handle;
-	if (!ManagedObjectHandles.RemoveAndCopyValueByHash(ObjectID.Get(), ObjectID, Handle))
+	FCSManagedObjectSlot Slot;
+	if (!ManagedObjectHandles.Remove(Index, Slot))
 	{
 		return;
 	}
 
-	UCSManagedAssembly* Assembly = FindOwningAssembly(Object->GetClass());
-	TSharedPtr<const FGCHandle> AssemblyHandle = Assembly->GetAssemblyHandle();
+	TSharedPtr<const FGCHandle> AssemblyHandle = Slot.OwningAssembly->GetAssemblyHandle();
 	
 #if WITH_EDITOR
 	if (!AssemblyHandle.IsValid())
@@ -96,8 +106,10 @@ void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 	}
 #endif
 	
-	Handle->Dispose(AssemblyHandle->GetHandle());
-	 
+	FGCHandle Handle(Slot.Handle);
+	QueueHandleDisposal(Handle, AssemblyHandle->GetHandle());
+	
+	const FCSObjectID ObjectID(Index);
 	TMap<FCSObjectID, TSharedPtr<FGCHandle>> FoundHandles;
 	if (!ManagedInterfaceWrapperHandles.RemoveAndCopyValueByHash(ObjectID.Get(), ObjectID, FoundHandles))
 	{
@@ -106,8 +118,46 @@ void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 
 	for (const TTuple<FCSObjectID, TSharedPtr<FGCHandle>>& IDToHandleKVP : FoundHandles)
 	{
-		IDToHandleKVP.Value->Dispose(AssemblyHandle->GetHandle());
+		QueueHandleDisposal(*IDToHandleKVP.Value, AssemblyHandle->GetHandle());
+	}
+}
+
+void UCSManager::QueueHandleDisposal(FGCHandle& Handle, FGCHandleIntPtr AssemblyHandle)
+{
+	if (Handle.IsNull())
+	{
+		return;
+	}
+	
+	PendingHandleDisposals.Enqueue(FCSPendingHandleDisposal{ Handle.GetHandle(), AssemblyHandle });
+	Handle.Invalidate();
+}
+
+void UCSManager::FlushPendingHandleDisposals()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::FlushPendingHandleDisposals);
+
+	FCSPendingHandleDisposal Disposal;
+	while (PendingHandleDisposals.Dequeue(Disposal))
+	{
+		HandleDisposalBatch.Add(Disposal);
 	}
+
+	TRACE_COUNTER_SET(UnrealSharp_DisposedHandles, HandleDisposalBatch.Num());
+
+	if (HandleDisposalBatch.IsEmpty())
+	{
+		return;
+	}
+
+	GetManagedCallbacks().DisposeBatch(&HandleDisposalBatch.GetData()->Handle, HandleDisposalBatch.Num());
+	HandleDisposalBatch.Reset();
+}
+
+void UCSManager::OnEnginePreExit()
+{
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+	FlushPendingHandleDisposals();
 }
 
 UPackage* UCSManager::FindOrAddManagedPackage(const FCSNamespace& Namespace)
@@ -190,38 +240,116 @@ void UCSManager::InitialAssemblyLoad()
 	
 	UE_LOGFMT(LogUnrealSharp, Display, "Discovered {0} load order manifests.", LoadOrderManifests.Num());
 
+	const bool bUseReflectionDataCache = GetDefault<UCSUnrealSharpSettings>()->bUseReflectionDataCache;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Every assembly is created up front, since the managed side looks them up by name while registering types from worker threads.
+	TArray<UCSManagedAssembly*> LoadOrder;
 	for (const FCSLoadOrderManifest& Manifest : LoadOrderManifests)
 	{
 		UE_LOGFMT(LogUnrealSharp, Display, "Loading assemblies from manifest: {0} (Priority: {1}", Manifest.Name, Manifest.Priority);
 		
 		for (const FString& Path : Manifest.AssemblyPaths)
 		{
-			LoadAssemblyByPath(Path, Manifest.bCollectible);
+			UCSManagedAssembly* Assembly = FindOrAddAssembly(Path, Manifest.bCollectible, bUseReflectionDataCache);
+			
+			if (!Assembly->IsAssemblyLoaded())
+			{
+				LoadOrder.AddUnique(Assembly);
+			}
+		}
+	}
+
+	PreloadAssemblies(LoadOrder);
+
+	// UFields are created on the game thread, in manifest order.
+	for (UCSManagedAssembly* Assembly : LoadOrder)
+	{
+		if (Assembly->LoadAssembly())
+		{
+			UE_LOGFMT(LogUnrealSharp, Display, "Successfully loaded assembly at {0}.", Assembly->GetAssemblyFilePath());
+		}
+		else
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "Failed to load assembly at {0}, skipping it.", Assembly->GetAssemblyFilePath());
 		}
 	}
+
+	UE_LOGFMT(LogUnrealSharp, Display, "Loaded {0} assemblies in {1} ms.", LoadOrder.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
-UCSManagedAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible)
+void UCSManager::PreloadAssemblies(const TArray<UCSManagedAssembly*>& LoadOrder)
 {
-	UCSManagedAssembly* Assembly;
-	
-	const FString AssemblyName = FPaths::GetBaseFilename(AssemblyPath);
-	if (UCSManagedAssembly* ExistingAssembly = FindAssembly(*AssemblyName))
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::PreloadAssemblies);
+
+	if (LoadOrder.Num() <= 1)
+	{
+		return;
+	}
+
+	// Each assembly waits for the assemblies it references, so its dependencies are in the AssemblyCache before its load context resolves them.
+	// Only references to assemblies earlier in the load order become edges, which keeps the graph acyclic.
+	TArray<UE::Tasks::FTask> PreloadTasks;
+	TMap<FString, int32> AssemblyIndices;
+	PreloadTasks.Reserve(LoadOrder.Num());
+
+	for (int32 Index = 0; Index < LoadOrder.Num(); ++Index)
 	{
-		if (ExistingAssembly->IsAssemblyLoaded())
+		UCSManagedAssembly* Assembly = LoadOrder[Index];
+		TArray<UE::Tasks::FTask> Prerequisites;
+
+		TArray<FString> References;
+		if (UnrealSharp::Project::GetAssemblyReferences(Assembly->GetAssemblyFilePath(), References))
 		{
-			UE_LOGFMT(LogUnrealSharp, Display, "Assembly {0} is already loaded.", AssemblyName);
-			return ExistingAssembly;
+			for (const FString& Reference : References)
+			{
+				if (const int32* ReferenceIndex = AssemblyIndices.Find(Reference))
+				{
+					Prerequisites.Add(PreloadTasks[*ReferenceIndex]);
+				}
+			}
 		}
-		
-		Assembly = ExistingAssembly;
+		else if (Index > 0)
+		{
+			// Without dependency information, fall back to the manifest order.
+			Prerequisites.Add(PreloadTasks[Index - 1]);
+		}
+
+		PreloadTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Assembly]
+		{
+			Assembly->PreloadAssembly();
+		}, Prerequisites));
+
+		AssemblyIndices.Add(FPaths::GetBaseFilename(Assembly->GetAssemblyFilePath()), Index);
 	}
-	else
+
+	UE::Tasks::Wait(PreloadTasks);
+}
+
+UCSManagedAssembly* UCSManager::FindOrAddAssembly(const FString& AssemblyPath, bool bIsCollectible, bool bUseReflectionDataCache)
+{
+	const FString AssemblyName = FPaths::GetBaseFilename(AssemblyPath);
+	if (UCSManagedAssembly* ExistingAssembly = FindAssembly(*AssemblyName))
 	{
-		Assembly = NewObject<UCSManagedAssembly>(this, *AssemblyName);
-		Assembly->Initialize(AssemblyPath, bIsCollectible);
-		
-		Assemblies.Add(Assembly->GetFName(), Assembly);
+		return ExistingAssembly;
+	}
+	
+	UCSManagedAssembly* Assembly = NewObject<UCSManagedAssembly>(this, *AssemblyName);
+	Assembly->Initialize(AssemblyPath, bIsCollectible);
+	Assembly->SetUseReflectionDataCache(bUseReflectionDataCache);
+	
+	Assemblies.Add(Assembly->GetFName(), Assembly);
+	return Assembly;
+}
+
+UCSManagedAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible, bool bUseReflectionDataCache)
+{
+	UCSManagedAssembly* Assembly = FindOrAddAssembly(AssemblyPath, bIsCollectible, bUseReflectionDataCache);
+	
+	if (Assembly->IsAssemblyLoaded())
+	{
+		UE_LOGFMT(LogUnrealSharp, Display, "Assembly {0} is already loaded.", Assembly->GetName());
+		return Assembly;
 	}
 
 	if (!Assembly->LoadAssembly())
@@ -276,14 +404,10 @@ FGCHandle UCSManager::FindManagedObject(const UObject* Object)
 		return FGCHandle::InvalidHandle();
 	}
 
-	const FCSObjectID ObjectID = Object->GetUniqueID();
-	if (TSharedPtr<FGCHandle>* FoundHandle = ManagedObjectHandles.FindByHash(ObjectID.Get(), ObjectID))
+	const FGCHandleIntPtr FoundHandle = ManagedObjectHandles.FindHandle(Object->GetUniqueID());
+	if (FoundHandle.ManagedHandlePtr)
 	{
-		TSharedPtr<FGCHandle> HandlePtr = *FoundHandle;
-		if (HandlePtr.IsValid() && !HandlePtr->IsNull())
-		{
-			return *HandlePtr;
-		}
+		return FoundHandle;
 	}
 
 	UCSManagedAssembly* OwningAssembly = FindOwningAssembly(Object->GetClass());
@@ -293,7 +417,7 @@ FGCHandle UCSManager::FindManagedObject(const UObject* Object)
 		return FGCHandle::InvalidHandle();
 	}
 
-	return *OwningAssembly->CreateManagedObjectFromNative(Object);
+	return OwningAssembly->CreateManagedObjectFromNative(Object);
 }
 
 FGCHandle UCSManager::FindManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass)
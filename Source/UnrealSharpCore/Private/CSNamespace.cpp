@@ -42,3 +42,8 @@ bool FCSNamespace::Serialize(FConstObject JsonObject)
 	JSON_READ_STRING(Namespace, IS_REQUIRED);
 	END_JSON_SERIALIZE
 }
+
+void FCSNamespace::Serialize(FArchive& Ar)
+{
+	Ar << Namespace;
+}
@@ -13,6 +13,7 @@
 #include "UnrealSharpUtils.h"
 #include "Subsystems/CSManagedSubsystemManager.h"
 #include "Utilities/CSClassUtilities.h"
+#include "CSUnrealSharpSettings.h"
 
 #if WITH_EDITOR
 #include "BlueprintActionDatabase.h"
@@ -37,6 +38,9 @@ void UCSManagedClassCompiler::Compile(UField* TypeToRecompile, const TSharedPtr<
 		// Initial setup. BP-compiler will handle future re-parenting.
 		Field->SetSuperStruct(NewSuperClass);
 	}
+	
+	const bool bLazyManagedObjectCreation = GetDefault<UCSUnrealSharpSettings>()->bLazyManagedObjectCreation;
+	Field->SetLazyManagedObjectCreation(bLazyManagedObjectCreation || ClassReflectionData->HasMetaData(TEXT("LazyManagedObject")));
 
 #if WITH_EDITOR
 	CreateOrUpdateOwningBlueprint(ClassReflectionData, Field, NewSuperClass);
@@ -109,6 +113,7 @@ void UCSManagedClassCompiler::CompileClass(TSharedPtr<FCSClassReflectionData> Cl
 	
 	FCSFunctionFactory::GenerateVirtualFunctions(Field, ClassReflectionData);
 	FCSFunctionFactory::GenerateFunctions(Field, ClassReflectionData->Functions);
+	FCSFunctionFactory::UpdateMethodHandles(Field);
 	
 	Field->ClassConstructor = &UCSClass::ManagedObjectConstructor;
 
@@ -257,6 +262,7 @@ void UCSManagedClassCompiler::SetupDefaultTickSettings(UObject* DefaultObject, c
 
 UObject* UCSManagedClassCompiler::CreateDeferredManagedCDO(UCSClass* ManagedClass)
 {
+	CompilePropertiesToInitialize(ManagedClass);
 	ManagedClass->SetDeferredCreation(true);
 	return ManagedClass->GetDefaultObject(true);
 }
@@ -272,6 +278,23 @@ void UCSManagedClassCompiler::FinalizeManagedCDO(UCSClass* ManagedClass)
 	SetupDefaultTickSettings(DefaultObject, ManagedClass);
 }
 
+void UCSManagedClassCompiler::CompilePropertiesToInitialize(UCSClass* ManagedClass)
+{
+	TArray<FProperty*> PropertiesToInitialize;
+	
+	for (TFieldIterator<FProperty> PropertyIt(ManagedClass, EFieldIterationFlags::None); PropertyIt; ++PropertyIt)
+	{
+		FProperty* Property = *PropertyIt;
+		
+		if (!Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			PropertiesToInitialize.Add(Property);
+		}
+	}
+	
+	ManagedClass->SetPropertiesToInitialize(MoveTemp(PropertiesToInitialize));
+}
+
 void UCSManagedClassCompiler::ImplementInterfaces(UClass* ManagedClass, const TArray<FCSTypeReferenceReflectionData>& Interfaces)
 {
 	for (const FCSTypeReferenceReflectionData& InterfaceData : Interfaces)
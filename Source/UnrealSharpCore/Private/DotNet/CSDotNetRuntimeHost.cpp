@@ -8,6 +8,8 @@
 #include "CSInstallationUtilities.h"
 #include "CSManagedPluginCallbacks.h"
 #include "CSPathsUtilities.h"
+#include "CSManagedCallbacksCache.h"
+#include "CSManagedGCHandle.h"
 #include "Misc/Paths.h"
 #include "Logging/StructuredLog.h"
 
@@ -21,6 +23,37 @@
 #pragma clang diagnostic ignored "-Wdangling-assignment"
 #endif
 
+#if UNREALSHARP_INTEROP_STATS
+// Swaps every native->managed callback for a thunk that records its calls into the interop stats.
+struct FCSManagedCallbacksInstrumentation
+{
+	static void Instrument(FCSManagedCallbacks& ManagedCallbacks);
+};
+
+void FCSManagedCallbacksInstrumentation::Instrument(FCSManagedCallbacks& ManagedCallbacks)
+{
+	static const FName OwnerName = TEXT("FCSManagedCallbacks");
+	
+#define INSTRUMENT_MANAGED_CALLBACK(CallbackName) \
+	ManagedCallbacks.CallbackName = UnrealSharp::InteropStats::MakeCallThunk<&FCSManagedCallbacks::CallbackName>(ManagedCallbacks.CallbackName, \
+		UnrealSharp::InteropStats::RegisterCounter(OwnerName, TEXT(#CallbackName)));
+	
+	INSTRUMENT_MANAGED_CALLBACK(CreateNewManagedObject)
+	INSTRUMENT_MANAGED_CALLBACK(CreateNewManagedObjectWrapper)
+	INSTRUMENT_MANAGED_CALLBACK(InvokeManagedMethod)
+	INSTRUMENT_MANAGED_CALLBACK(InvokeDelegate)
+	INSTRUMENT_MANAGED_CALLBACK(GetManagedMethod)
+	INSTRUMENT_MANAGED_CALLBACK(GetManagedMethods)
+	INSTRUMENT_MANAGED_CALLBACK(GetManagedTypeHandle)
+	INSTRUMENT_MANAGED_CALLBACK(InitializeStructure)
+	INSTRUMENT_MANAGED_CALLBACK(Dispose)
+	INSTRUMENT_MANAGED_CALLBACK(FreeHandle)
+	INSTRUMENT_MANAGED_CALLBACK(DisposeBatch)
+	
+#undef INSTRUMENT_MANAGED_CALLBACK
+}
+#endif
+
 FCSDotNetRuntimeHost::~FCSDotNetRuntimeHost()
 {
 	ShutdownManagedRuntime();
@@ -55,11 +88,15 @@ bool FCSDotNetRuntimeHost::InitializeManagedRuntime()
 	if (!InitializeUnrealSharp(*UserWorkingDirectory,
 		*UnrealSharpLibraryAssembly,
 		&GetManagedPluginCallbacks(),
-		(const void*)&FCSBindsRegistry::GetBoundFunction,
+		&FCSBindsRegistry::GetBindsCallbacks(),
 		&GetManagedCallbacks()))
 	{
 		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to initialize UnrealSharp!");
 	}
+
+#if UNREALSHARP_INTEROP_STATS
+	FCSManagedCallbacksInstrumentation::Instrument(GetManagedCallbacks());
+#endif
 	
 #if !(UE_BUILD_SHIPPING)
 	if (FParse::Param(FCommandLine::Get(), TEXT("-waitformanageddebugger")))
@@ -177,6 +177,14 @@ void FCSFunctionFactory::GenerateFunctions(UClass* Outer, const TArray<FCSFuncti
 	}
 }
 
+void FCSFunctionFactory::UpdateMethodHandles(UClass* Outer)
+{
+	if (!UCSFunctionBase::UpdateMethodHandles(Outer))
+	{
+		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to update method handles for functions in class {0}.", *Outer->GetName());
+	}
+}
+
 void FCSFunctionFactory::AddFunctionToOuter(UClass* Outer, UCSFunctionBase* Function)
 {
 	Function->Next = Outer->Children;
@@ -200,16 +208,12 @@ void FCSFunctionFactory::FinalizeFunctionSetup(UClass* Outer, UCSFunctionBase* F
 	}
 	else
 	{
+		Function->SetCallPlan(FCSFunctionCallPlan::Compile(Function));
 		Outer->AddNativeFunction(*Function->GetName(), &UCSFunction_Params::InvokeManagedMethod_Params);
 	}
 	
 	Function->Bind();
 	Outer->AddFunctionToFunctionMap(Function, Function->GetFName());
-
-	if (!Function->UpdateMethodHandle())
-	{
-		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to update method handle for function {0} in class {1}.", *Function->GetName(), *Outer->GetName());
-	}
 }
 
 UCSFunctionBase* FCSFunctionFactory::CreateFunction_Internal(UClass* Outer, const FName& Name, const FCSFunctionReflectionData& FunctionReflectionData, EFunctionFlags FunctionFlags, UStruct* ParentFunction)
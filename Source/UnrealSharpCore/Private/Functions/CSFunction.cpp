@@ -1,4 +1,5 @@
 #include "Functions/CSFunction.h"
+#include "CSInteropStats.h"
 #include "CSManagedGCHandle.h"
 #include "CSManager.h"
 #include "CSUnrealSharpSettings.h"
@@ -35,23 +36,79 @@ void UCSFunctionBase::Bind()
 
 bool UCSFunctionBase::UpdateMethodHandle()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunctionBase::UpdateMethodHandle);
+	if (HasValidMethodHandle())
+	{
+		return true;
+	}
 	
-	// Ignore delegate signatures and classes that are not the generated class.
+	// The other functions of the class are just as stale, so resolve all of them at once.
+	// Only this function's handle matters here, an unresolved sibling shouldn't fail the call.
+	UpdateMethodHandles(GetOwnerClass());
+	return HasValidMethodHandle();
+}
+
+bool UCSFunctionBase::UpdateMethodHandles(UClass* Class)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunctionBase::UpdateMethodHandles);
+	
+	// Ignore classes that are not the generated class.
 	// The Blueprint skeleton class is an example of a class that is not the generated class, but still has managed functions.
-	if (HasValidMethodHandle() || !IsOwnedByManagedClass() || GetOwnerClass()->HasAllClassFlags(CLASS_Interface))
+	if (!FCSClassUtilities::IsManagedClass(Class) || Class->HasAllClassFlags(CLASS_Interface))
 	{
 		return true;
 	}
 	
-	UCSClass* ManagedClass = static_cast<UCSClass*>(GetOwnerClass());
+	TArray<UCSFunctionBase*, TInlineAllocator<32>> Functions;
+	for (TFieldIterator<UCSFunctionBase> FunctionIt(Class, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+	{
+		if (!FunctionIt->HasValidMethodHandle())
+		{
+			Functions.Add(*FunctionIt);
+		}
+	}
+	
+	if (Functions.IsEmpty())
+	{
+		return true;
+	}
+	
+	TArray<FString, TInlineAllocator<32>> MethodNames;
+	TArray<const TCHAR*, TInlineAllocator<32>> MethodNamePtrs;
+	MethodNames.Reserve(Functions.Num());
+	MethodNamePtrs.Reserve(Functions.Num());
+	
+	for (const UCSFunctionBase* Function : Functions)
+	{
+		MethodNamePtrs.Add(*MethodNames.Add_GetRef(Function->GetName()));
+	}
+	
+	UCSClass* ManagedClass = static_cast<UCSClass*>(Class);
 	UCSManagedAssembly* Assembly = ManagedClass->GetOwningAssembly();
+	TSharedPtr<FGCHandle> TypeHandle = ManagedClass->GetManagedTypeDefinition()->GetTypeGCHandle();
+	
+	TArray<TSharedPtr<FGCHandle>, TInlineAllocator<32>> MethodHandles;
+	TArray<void*, TInlineAllocator<32>> UnmanagedInvokers;
+	MethodHandles.SetNum(Functions.Num());
+	UnmanagedInvokers.SetNumZeroed(Functions.Num());
 	
-	TSharedPtr<FCSManagedTypeDefinition> ClassInfo = ManagedClass->GetManagedTypeDefinition();
-	TSharedPtr<FGCHandle> TypeHandle = ClassInfo->GetTypeGCHandle();
+	const int32 NumFound = Assembly->FindMethodHandles(TypeHandle, MethodNamePtrs, MethodHandles, UnmanagedInvokers);
 	
-	MethodHandle = Assembly->FindMethodHandle(TypeHandle, FString::Printf(TEXT("Invoke_%s"), *GetName()));
-	return MethodHandle.IsValid();
+	for (int32 Index = 0; Index < Functions.Num(); ++Index)
+	{
+		UCSFunctionBase* Function = Functions[Index];
+		Function->MethodHandle = MoveTemp(MethodHandles[Index]);
+		Function->UnmanagedInvoker = reinterpret_cast<FUnmanagedInvoker>(UnmanagedInvokers[Index]);
+
+#if UNREALSHARP_INTEROP_STATS
+		// Blueprint->C# calls skip FCSManagedCallbacks when the function has its own invoker, so count those per function.
+		if (Function->UnmanagedInvoker && Function->InvokerCounterIndex == INDEX_NONE)
+		{
+			Function->InvokerCounterIndex = UnrealSharp::InteropStats::RegisterCounter(Class->GetFName(), Function->GetFName());
+		}
+#endif
+	}
+	
+	return NumFound == Functions.Num();
 }
 
 bool UCSFunctionBase::IsOwnedByManagedClass() const
@@ -69,17 +126,14 @@ void UCSFunctionBase::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Sta
 	
 	Stack.Code += !!Stack.Code;
 
+	UCSManager& Manager = UCSManager::Get();
+	Manager.FlushPendingHandleDisposalsBeforeManagedCall();
+
 	// Prefer using World as context since it's more stable
-	UObject* WorldContext = nullptr;
 	if (Stack.Object)
 	{
 		UWorld* World = Stack.Object->GetWorld();
-		WorldContext = World ? World : Stack.Object;
-	}
-
-	if (WorldContext)
-	{
-		UCSManager::Get().SetCurrentWorldContext(WorldContext);
+		Manager.SetCurrentWorldContext(World ? World : Stack.Object);
 	}
 
 	UCSFunctionBase* ManagedFunction = static_cast<UCSFunctionBase*>(Stack.CurrentNativeFunction);
@@ -92,19 +146,39 @@ void UCSFunctionBase::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Sta
 	}
 #endif
 
+	const FGCHandleIntPtr ObjectHandle = ObjectToInvokeOn ? Manager.FindManagedObjectHandle(ObjectToInvokeOn) : FGCHandleIntPtr();
+
+	// The managed side only writes to the message when the invoked method throws, so this stays unallocated on success.
 	FString ExceptionMessage;
-	int ReturnCode = GetManagedCallbacks().InvokeManagedMethod(
-		UCSManager::Get().FindManagedObject(ObjectToInvokeOn).GetPointer(),
-		ManagedFunction->MethodHandle->GetPointer(),
-		Stack.Locals,
-		RESULT_PARAM,
-		&ExceptionMessage);
+	int ReturnCode;
+	
+	if (ManagedFunction->UnmanagedInvoker)
+	{
+#if UNREALSHARP_INTEROP_STATS
+		UnrealSharp::InteropStats::FScopedCallTimer CallTimer(ManagedFunction->InvokerCounterIndex);
+#endif
+		ReturnCode = ManagedFunction->UnmanagedInvoker(ObjectHandle.ManagedHandlePtr, Stack.Locals, RESULT_PARAM, &ExceptionMessage);
+	}
+	else
+	{
+		ReturnCode = GetManagedCallbacks().InvokeManagedMethod(
+			ObjectHandle.ManagedHandlePtr,
+			ManagedFunction->MethodHandle->GetPointer(),
+			Stack.Locals,
+			RESULT_PARAM,
+			&ExceptionMessage);
+	}
 	
-	if (ReturnCode == 0)
+	if (LIKELY(ReturnCode == 0))
 	{
 		return;
 	}
 
+	HandleManagedException(ObjectToInvokeOn, Stack, ExceptionMessage);
+}
+
+void UCSFunctionBase::HandleManagedException(UObject* ObjectToInvokeOn, FFrame& Stack, const FString& ExceptionMessage)
+{
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
 	const EBlueprintExceptionType::Type ExceptionType = GetDefault<UCSUnrealSharpSettings>()->bCrashOnException ? EBlueprintExceptionType::FatalError : EBlueprintExceptionType::UserRaisedError;
 #else
@@ -0,0 +1,44 @@
+#include "Functions/CSFunctionCallPlan.h"
+
+FCSFunctionCallPlan FCSFunctionCallPlan::Compile(const UFunction* Function)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSFunctionCallPlan::Compile);
+
+	FCSFunctionCallPlan Plan;
+	Plan.ParmsSize = Function->GetStructureSize();
+
+	for (TFieldIterator<FProperty> ParamIt(Function, EFieldIteratorFlags::ExcludeSuper); ParamIt; ++ParamIt)
+	{
+		FProperty* FunctionParameter = *ParamIt;
+		const EPropertyFlags ParamFlags = FunctionParameter->GetPropertyFlags();
+
+		if (!(ParamFlags & CPF_ZeroConstructor))
+		{
+			Plan.PropertiesToInitialize.Add(FunctionParameter);
+		}
+
+		if (!(ParamFlags & (CPF_IsPlainOldData | CPF_NoDestructor)))
+		{
+			Plan.PropertiesToDestroy.Add(FunctionParameter);
+		}
+
+		if (ParamFlags & CPF_ReturnParm)
+		{
+			continue;
+		}
+
+		constexpr EPropertyFlags Relevant = CPF_Parm | CPF_ReturnParm | CPF_OutParm | CPF_ConstParm;
+		constexpr EPropertyFlags Wanted = CPF_Parm | CPF_OutParm;
+
+		FCSParameterStep& Step = Plan.Parameters.AddDefaulted_GetRef();
+		Step.Property = FunctionParameter;
+		Step.Offset = FunctionParameter->GetOffset_ForUFunction();
+		Step.bIsOutParm = (ParamFlags & CPF_OutParm) != 0;
+		Step.bCopyBack = (ParamFlags & Relevant) == Wanted;
+
+		Plan.NumCopyBackParms += Step.bCopyBack;
+	}
+
+	Plan.bIsCompiled = true;
+	return Plan;
+}
@@ -3,91 +3,109 @@
 void UCSFunction_Params::InvokeManagedMethod_Params(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunction_Params::InvokeManagedMethod_Params);
-	
-	FOutParmRec* OutParameters = nullptr;
-	FOutParmRec** LastOut = &OutParameters;
-	uint8* ArgumentBuffer = Stack.Locals;
+
 	uint8* LocalsCache = Stack.Locals;
 	bool IsCalledFromBlueprint = Stack.Code != nullptr;
-	
-	if (IsCalledFromBlueprint)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunction_Params::InvokeManagedMethod_Params::CopyParametersToBuffer);
-		
-		ArgumentBuffer = (uint8*)FMemory_Alloca(FMath::Max<int32>(1, Stack.CurrentNativeFunction->GetStructureSize()));
-		Stack.CurrentNativeFunction->InitializeStruct(ArgumentBuffer);
-	
-		for (TFieldIterator<FProperty> ParamIt(Stack.CurrentNativeFunction, EFieldIteratorFlags::ExcludeSuper); ParamIt; ++ParamIt)
-		{
-			FProperty* FunctionParameter = *ParamIt;
 
-			const EPropertyFlags ParamFlags = FunctionParameter->GetPropertyFlags();
+	if (!IsCalledFromBlueprint)
+	{
+		InvokeManagedMethod(ObjectToInvokeOn, Stack, RESULT_PARAM);
 
-			if (ParamFlags & CPF_ReturnParm)
+		for (FOutParmRec* OutParameter = Stack.OutParms; OutParameter != nullptr; OutParameter = OutParameter->NextOutParm)
+		{
+			if (OutParameter->Property->HasAnyPropertyFlags(CPF_ReturnParm))
 			{
 				continue;
 			}
 
+			const uint8* ValueAddress = OutParameter->Property->ContainerPtrToValuePtr<uint8>(LocalsCache);
+			if (OutParameter->PropAddr != ValueAddress)
+			{
+				OutParameter->Property->CopyCompleteValue(OutParameter->PropAddr, ValueAddress);
+			}
+		}
+
+		return;
+	}
+
+	UCSFunctionBase* ManagedFunction = static_cast<UCSFunctionBase*>(Stack.CurrentNativeFunction);
+
+#if WITH_EDITOR
+	// Functions duplicated for reinstancing don't carry over the plan, since it isn't a UPROPERTY.
+	if (!ManagedFunction->GetCallPlan().IsCompiled())
+	{
+		ManagedFunction->SetCallPlan(FCSFunctionCallPlan::Compile(ManagedFunction));
+	}
+#endif
+
+	const FCSFunctionCallPlan& CallPlan = ManagedFunction->GetCallPlan();
+
+	uint8* ArgumentBuffer = static_cast<uint8*>(FMemory_Alloca(FMath::Max<int32>(1, CallPlan.ParmsSize)));
+	uint8** CopyBackAddresses = static_cast<uint8**>(FMemory_Alloca(FMath::Max<int32>(1, CallPlan.NumCopyBackParms) * sizeof(uint8*)));
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunction_Params::InvokeManagedMethod_Params::CopyParametersToBuffer);
+
+		FMemory::Memzero(ArgumentBuffer, CallPlan.ParmsSize);
+
+		for (FProperty* Property : CallPlan.PropertiesToInitialize)
+		{
+			Property->InitializeValue_InContainer(ArgumentBuffer);
+		}
+
+		int32 CopyBackIndex = 0;
+		for (const FCSParameterStep& Step : CallPlan.Parameters)
+		{
 			Stack.MostRecentPropertyAddress = nullptr;
 			Stack.MostRecentPropertyContainer = nullptr;
-			
-			uint8* LocalValue = FunctionParameter->ContainerPtrToValuePtr<uint8>(ArgumentBuffer);
-			Stack.StepCompiledIn(LocalValue, FunctionParameter->GetClass());
-		
+
+			uint8* LocalValue = ArgumentBuffer + Step.Offset;
+			Stack.StepCompiledIn(LocalValue, Step.Property->GetClass());
+
 			uint8* ValueAddress = LocalValue;
-			
-			if ((ParamFlags & CPF_OutParm) && Stack.MostRecentPropertyAddress)
+
+			if (Step.bIsOutParm && Stack.MostRecentPropertyAddress)
 			{
 				ValueAddress = Stack.MostRecentPropertyAddress;
 			}
-			
-			constexpr EPropertyFlags Relevant = CPF_Parm | CPF_ReturnParm | CPF_OutParm | CPF_ConstParm;
-			constexpr EPropertyFlags Wanted = CPF_Parm | CPF_OutParm;
-			
-			if ((ParamFlags & Relevant) == Wanted)
+
+			if (Step.bCopyBack)
 			{
-				FOutParmRec* Out = static_cast<FOutParmRec*>(FMemory_Alloca(sizeof(FOutParmRec)));
-				Out->Property = FunctionParameter;
-				Out->PropAddr = ValueAddress;
-				Out->NextOutParm = nullptr;
-				
-				*LastOut = Out;
-				LastOut = &Out->NextOutParm;
+				CopyBackAddresses[CopyBackIndex++] = ValueAddress;
 			}
-			
+
 			if (ValueAddress != LocalValue)
 			{
-				FunctionParameter->CopyCompleteValue(LocalValue, ValueAddress);
+				Step.Property->CopyCompleteValue(LocalValue, ValueAddress);
 			}
 		}
-
-		Stack.Locals = ArgumentBuffer;
 	}
-	else
-	{
-		OutParameters = Stack.OutParms;
-	}
-	
+
+	Stack.Locals = ArgumentBuffer;
+
 	InvokeManagedMethod(ObjectToInvokeOn, Stack, RESULT_PARAM);
-	
-	for (FOutParmRec* OutParameter = OutParameters; OutParameter != nullptr; OutParameter = OutParameter->NextOutParm)
+
+	int32 CopyBackIndex = 0;
+	for (const FCSParameterStep& Step : CallPlan.Parameters)
 	{
-		if (OutParameter->Property->HasAnyPropertyFlags(CPF_ReturnParm))
+		if (!Step.bCopyBack)
 		{
 			continue;
 		}
-		
-		const uint8* ValueAddress = OutParameter->Property->ContainerPtrToValuePtr<uint8>(ArgumentBuffer);
-		if (OutParameter->PropAddr != ValueAddress)
+
+		uint8* PropAddr = CopyBackAddresses[CopyBackIndex++];
+		const uint8* ValueAddress = ArgumentBuffer + Step.Offset;
+
+		if (PropAddr != ValueAddress)
 		{
-			OutParameter->Property->CopyCompleteValue(OutParameter->PropAddr, ValueAddress);
+			Step.Property->CopyCompleteValue(PropAddr, ValueAddress);
 		}
 	}
-	
-	if (IsCalledFromBlueprint)
+
+	for (FProperty* Property : CallPlan.PropertiesToDestroy)
 	{
-		Stack.CurrentNativeFunction->DestroyStruct(ArgumentBuffer);
+		Property->DestroyValue_InContainer(ArgumentBuffer);
 	}
 
 	Stack.Locals = LocalsCache;
-}
\ No newline at end of file
+}
@@ -15,3 +15,12 @@ bool FCSClassBaseReflectionData::Serialize(FConstObject JsonObject)
 		
 	END_JSON_SERIALIZE
 }
+
+void FCSClassBaseReflectionData::Serialize(FArchive& Ar)
+{
+	FCSStructReflectionData::Serialize(Ar);
+	
+	SerializeArray(Ar, Functions);
+	SerializeEnum(Ar, ClassFlags);
+	Ar << Config;
+}
@@ -15,3 +15,13 @@ bool FCSClassReflectionData::Serialize(FConstObject JsonObject)
 		
 	END_JSON_SERIALIZE
 }
+
+void FCSClassReflectionData::Serialize(FArchive& Ar)
+{
+	FCSClassBaseReflectionData::Serialize(Ar);
+	
+	ParentClass.Serialize(Ar);
+	Ar << Overrides;
+	SerializeArray(Ar, Interfaces);
+	SerializeArray(Ar, ComponentOverrides);
+}
@@ -13,3 +13,10 @@ bool FCSComponentOverrideReflectionData::Serialize(FConstObject JsonObject)
 	
 	END_JSON_SERIALIZE
 }
+
+void FCSComponentOverrideReflectionData::Serialize(FArchive& Ar)
+{
+	OwningClass.Serialize(Ar);
+	ComponentType.Serialize(Ar);
+	Ar << PropertyName;
+}
@@ -15,3 +15,12 @@ bool FCSDefaultComponentType::Serialize(FConstObject JsonObject)
 
 	END_JSON_SERIALIZE
 }
+
+void FCSDefaultComponentType::Serialize(FArchive& Ar)
+{
+	FCSFieldType::Serialize(Ar);
+	
+	Ar << IsRootComponent;
+	Ar << AttachmentComponent;
+	Ar << AttachmentSocket;
+}
@@ -12,3 +12,9 @@ bool FCSEnumReflectionData::Serialize(FConstObject JsonObject)
 		
 	END_JSON_SERIALIZE
 }
+
+void FCSEnumReflectionData::Serialize(FArchive& Ar)
+{
+	FCSTypeReferenceReflectionData::Serialize(Ar);
+	Ar << EnumNames;
+}
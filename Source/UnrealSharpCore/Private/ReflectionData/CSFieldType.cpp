@@ -12,3 +12,9 @@ bool FCSFieldType::Serialize(FConstObject JsonObject)
 
 	END_JSON_SERIALIZE
 }
+
+void FCSFieldType::Serialize(FArchive& Ar)
+{
+	FCSUnrealType::Serialize(Ar);
+	InnerType.Serialize(Ar);
+}
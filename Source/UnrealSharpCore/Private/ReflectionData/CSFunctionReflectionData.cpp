@@ -13,3 +13,19 @@ bool FCSFunctionReflectionData::Serialize(FConstObject JsonObject)
 		
 	END_JSON_SERIALIZE
 }
+
+void FCSFunctionReflectionData::Serialize(FArchive& Ar)
+{
+	FCSStructReflectionData::Serialize(Ar);
+	
+	SerializeEnum(Ar, FunctionFlags);
+	
+	// The return value is optional, its inner type is only set when the function has one.
+	bool bHasReturnValue = ReturnValue.InnerType.IsValid();
+	Ar << bHasReturnValue;
+	
+	if (bHasReturnValue)
+	{
+		ReturnValue.Serialize(Ar);
+	}
+}
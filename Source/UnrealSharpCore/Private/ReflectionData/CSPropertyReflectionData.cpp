@@ -46,3 +46,59 @@ bool FCSPropertyReflectionData::Serialize(FConstObject JsonObject)
 	CALL_SERIALIZE(InnerType->Serialize(JsonObject));
 	END_JSON_SERIALIZE
 }
+
+void FCSPropertyReflectionData::Serialize(FArchive& Ar)
+{
+	FCSTypeReferenceReflectionData::Serialize(Ar);
+	
+	SerializeEnum(Ar, LifetimeCondition);
+	SerializeEnum(Ar, PropertyFlags);
+	Ar << ReplicatedUsing;
+	
+	SerializeAccessor(Ar, GetterMethod);
+	SerializeAccessor(Ar, SetterMethod);
+	
+	ECSPropertyType PropertyType = InnerType.IsValid() ? InnerType->PropertyType : ECSPropertyType::Unknown;
+	SerializeEnum(Ar, PropertyType);
+	
+	if (Ar.IsLoading())
+	{
+		// A corrupt cache must fail the read so the type is deserialized from the assembly again, not reach the generator lookup's assert.
+		UCSPropertyGenerator* PropertyGenerator = PropertyType < ECSPropertyType::MAX && LifetimeCondition < COND_Max ? FCSPropertyFactory::FindPropertyGenerator(PropertyType) : nullptr;
+		if (Ar.IsError() || !PropertyGenerator)
+		{
+			Ar.SetError();
+			return;
+		}
+		
+		InnerType = PropertyGenerator->CreatePropertyInnerTypeData(PropertyType);
+		
+		if (!InnerType.IsValid())
+		{
+			Ar.SetError();
+			return;
+		}
+		
+		InnerType->PropertyType = PropertyType;
+	}
+	
+	InnerType->Serialize(Ar);
+}
+
+void FCSPropertyReflectionData::SerializeAccessor(FArchive& Ar, TSharedPtr<FCSFunctionReflectionData>& Accessor)
+{
+	bool bHasAccessor = Accessor.IsValid();
+	Ar << bHasAccessor;
+	
+	if (!bHasAccessor)
+	{
+		return;
+	}
+	
+	if (Ar.IsLoading())
+	{
+		Accessor = MakeShared<FCSFunctionReflectionData>();
+	}
+	
+	Accessor->Serialize(Ar);
+}
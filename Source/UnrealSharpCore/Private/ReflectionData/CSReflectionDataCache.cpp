@@ -0,0 +1,233 @@
+#include "ReflectionData/CSReflectionDataCache.h"
+
+#include "UnrealSharpCore.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "ReflectionData/CSTypeReferenceReflectionData.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	// Part of the cache key, so a plugin or engine update discards caches written by a serializer that may since have changed.
+	uint64 ComputeBuildHash()
+	{
+		FString BuildVersion = FEngineVersion::Current().ToString();
+		
+		if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UnrealSharp")))
+		{
+			BuildVersion += TEXT("|") + Plugin->GetDescriptor().VersionName;
+		}
+		
+		return CityHash64(reinterpret_cast<const char*>(*BuildVersion), BuildVersion.Len() * sizeof(TCHAR));
+	}
+}
+
+FCSReflectionDataCache::FCSReflectionDataCache(const FString& InAssemblyFilePath)
+	: AssemblyFilePath(InAssemblyFilePath)
+	, CacheFilePath(FPaths::ChangeExtension(InAssemblyFilePath, TEXT("reflectioncache")))
+{
+}
+
+FCSReflectionDataCache::~FCSReflectionDataCache()
+{
+	Unmap();
+}
+
+void FCSReflectionDataCache::Load()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSReflectionDataCache::Load);
+
+	TArray<uint8> AssemblyBytes;
+	if (!FFileHelper::LoadFileToArray(AssemblyBytes, *AssemblyFilePath))
+	{
+		return;
+	}
+
+	AssemblyHash = CityHash64(reinterpret_cast<const char*>(AssemblyBytes.GetData()), AssemblyBytes.Num());
+	BuildHash = ComputeBuildHash();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*CacheFilePath))
+	{
+		return;
+	}
+
+	FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*CacheFilePath);
+	if (OpenResult.HasError())
+	{
+		return;
+	}
+
+	MappedFile = OpenResult.StealValue();
+	MappedRegion.Reset(MappedFile->MapRegion());
+
+	if (!MappedRegion.IsValid())
+	{
+		Unmap();
+		return;
+	}
+
+	const uint8* MappedData = MappedRegion->GetMappedPtr();
+	const int64 MappedSize = MappedRegion->GetMappedSize();
+	FMemoryReaderView Reader(MakeArrayView(MappedData, MappedSize));
+
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	uint64 FileBuildHash = 0;
+	uint64 FileAssemblyHash = 0;
+	int32 NumTypes = 0;
+	Reader << FileMagic << FileVersion << FileBuildHash << FileAssemblyHash << NumTypes;
+
+	if (Reader.IsError() || FileMagic != Magic || FileVersion != Version || FileBuildHash != BuildHash || FileAssemblyHash != AssemblyHash || NumTypes < 0)
+	{
+		UE_LOGFMT(LogUnrealSharp, Verbose, "Reflection data cache {0} is out of date", CacheFilePath);
+		Unmap();
+		return;
+	}
+
+	CachedTypes.Reserve(NumTypes);
+	for (int32 Index = 0; Index < NumTypes; ++Index)
+	{
+		FCSFieldName FieldName;
+		FieldName.Serialize(Reader);
+
+		FCachedType CachedType;
+		Reader << CachedType.StructuralHash << CachedType.Offset << CachedType.Size;
+
+		CachedTypes.Add(FieldName, MoveTemp(CachedType));
+	}
+
+	const int64 DataSize = MappedSize - Reader.Tell();
+	DataStart = MappedData + Reader.Tell();
+
+	for (const TPair<FCSFieldName, FCachedType>& CachedType : CachedTypes)
+	{
+		if (CachedType.Value.Offset < 0 || CachedType.Value.Size < 0 || CachedType.Value.Offset + CachedType.Value.Size > DataSize)
+		{
+			Reader.SetError();
+			break;
+		}
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOGFMT(LogUnrealSharp, Warning, "Reflection data cache {0} is corrupt and will be rebuilt", CacheFilePath);
+		CachedTypes.Reset();
+		Unmap();
+		return;
+	}
+
+	UE_LOGFMT(LogUnrealSharp, Verbose, "Mapped reflection data cache {0} with {1} types", CacheFilePath, NumTypes);
+}
+
+void FCSReflectionDataCache::Save()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSReflectionDataCache::Save);
+
+	if (!bIsDirty || AssemblyHash == 0)
+	{
+		return;
+	}
+
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+
+	uint32 FileMagic = Magic;
+	uint32 FileVersion = Version;
+	int32 NumTypes = CachedTypes.Num();
+	Writer << FileMagic << FileVersion << BuildHash << AssemblyHash << NumTypes;
+
+	int64 Offset = 0;
+	for (TPair<FCSFieldName, FCachedType>& CachedType : CachedTypes)
+	{
+		int64 Size = GetCachedData(CachedType.Value).Num();
+
+		FCSFieldName FieldName = CachedType.Key;
+		FieldName.Serialize(Writer);
+		Writer << CachedType.Value.StructuralHash << Offset << Size;
+
+		Offset += Size;
+	}
+
+	for (const TPair<FCSFieldName, FCachedType>& CachedType : CachedTypes)
+	{
+		FileData.Append(GetCachedData(CachedType.Value));
+	}
+
+	// The file can't be replaced while it is still mapped.
+	Unmap();
+	CachedTypes.Reset();
+	bIsDirty = false;
+
+	// Written next to the cache and then moved over it, so a crash mid-write can't leave a truncated cache behind.
+	// A read-only install directory only means the next start won't be cached.
+	const FString TempFilePath = CacheFilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(FileData, *TempFilePath) || !IFileManager::Get().Move(*CacheFilePath, *TempFilePath, true, true))
+	{
+		UE_LOGFMT(LogUnrealSharp, Verbose, "Failed to write reflection data cache {0}", CacheFilePath);
+		IFileManager::Get().Delete(*TempFilePath, false, false, true);
+	}
+}
+
+bool FCSReflectionDataCache::Read(const FCSFieldName& FieldName, uint64 StructuralHash, FCSTypeReferenceReflectionData& OutReflectionData) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSReflectionDataCache::Read);
+
+	const FCachedType* CachedType = CachedTypes.Find(FieldName);
+	if (!CachedType || CachedType->StructuralHash != StructuralHash)
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader(GetCachedData(*CachedType));
+	OutReflectionData.Serialize(Reader);
+	return !Reader.IsError();
+}
+
+void FCSReflectionDataCache::Add(const FCSFieldName& FieldName, uint64 StructuralHash, TArray<uint8>&& SerializedData)
+{
+	if (AssemblyHash == 0)
+	{
+		return;
+	}
+
+	FCachedType& CachedType = CachedTypes.FindOrAdd(FieldName);
+	CachedType.StructuralHash = StructuralHash;
+	CachedType.Offset = 0;
+	CachedType.Size = SerializedData.Num();
+	CachedType.Data = MoveTemp(SerializedData);
+
+	bIsDirty = true;
+}
+
+TArray<uint8> FCSReflectionDataCache::SerializeReflectionData(FCSTypeReferenceReflectionData& ReflectionData)
+{
+	TArray<uint8> SerializedData;
+	FMemoryWriter Writer(SerializedData);
+	ReflectionData.Serialize(Writer);
+	return SerializedData;
+}
+
+TConstArrayView<uint8> FCSReflectionDataCache::GetCachedData(const FCachedType& CachedType) const
+{
+	if (!CachedType.Data.IsEmpty() || !DataStart)
+	{
+		return CachedType.Data;
+	}
+
+	return MakeArrayView(DataStart + CachedType.Offset, CachedType.Size);
+}
+
+void FCSReflectionDataCache::Unmap()
+{
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	DataStart = nullptr;
+}
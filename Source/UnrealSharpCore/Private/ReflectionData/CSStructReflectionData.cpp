@@ -13,3 +13,9 @@ bool FCSStructReflectionData::Serialize(FConstObject JsonObject)
 		
 	END_JSON_SERIALIZE
 }
+
+void FCSStructReflectionData::Serialize(FArchive& Ar)
+{
+	FCSTypeReferenceReflectionData::Serialize(Ar);
+	SerializeArray(Ar, Properties);
+}
@@ -12,3 +12,9 @@ bool FCSTemplateType::Serialize(FConstObject JsonObject)
 
 	END_JSON_SERIALIZE
 }
+
+void FCSTemplateType::Serialize(FArchive& Ar)
+{
+	FCSUnrealType::Serialize(Ar);
+	SerializeArray(Ar, TemplateParameters);
+}
@@ -2,6 +2,7 @@
 #include "CSManager.h"
 #include "Json/CSJsonMacros.h"
 #include "Json/CSJsonUtilities.h"
+#include "Hash/CityHash.h"
 
 bool FCSMetaDataEntry::Serialize(FConstObject JsonObject)
 {
@@ -13,19 +14,46 @@ bool FCSMetaDataEntry::Serialize(FConstObject JsonObject)
 	END_JSON_SERIALIZE
 }
 
+void FCSMetaDataEntry::Serialize(FArchive& Ar)
+{
+	Ar << Key;
+	Ar << Value;
+}
+
 void FCSTypeReferenceReflectionData::SerializeFromJsonString(TCHAR* RawJsonString)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FCSTypeReferenceReflectionData::StartSerializeFromJson);
 	
-	RawReflectionData = RawJsonString;
-	
 	FDocument ParsedDocument;
 	if (!ParseJsonString(RawJsonString, ParsedDocument))
 	{
 		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to parse JSON reflection data for type {0}. Check logs for meta data failing to parse.", *FieldName.GetFullName().ToString());
 	}
 	
-	TOptional<FConstObject> RootObject = GetRootObject(ParsedDocument);
+	SerializeFromDocument(ParsedDocument);
+}
+
+void FCSTypeReferenceReflectionData::SerializeFromBinary(const uint8* Data, int32 Size)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSTypeReferenceReflectionData::SerializeFromBinary);
+	
+	FDocument ParsedDocument;
+	if (!ParseBinaryJson(Data, Size, ParsedDocument))
+	{
+		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to parse binary reflection data for type {0}. The assembly may have been compiled with an incompatible glue generator.", *FieldName.GetFullName().ToString());
+	}
+	
+	SerializeFromDocument(ParsedDocument);
+}
+
+uint64 FCSTypeReferenceReflectionData::HashJsonString(const TCHAR* RawJsonString)
+{
+	return CityHash64(reinterpret_cast<const char*>(RawJsonString), FCString::Strlen(RawJsonString) * sizeof(TCHAR));
+}
+
+void FCSTypeReferenceReflectionData::SerializeFromDocument(const FDocument& Document)
+{
+	TOptional<FConstObject> RootObject = GetRootObject(Document);
 	if (!Serialize(RootObject.GetValue()))
 	{
 		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to parse JSON reflection data for type {0}. Check logs for meta data failing to parse.", *FieldName.GetFullName().ToString());
@@ -44,6 +72,14 @@ bool FCSTypeReferenceReflectionData::Serialize(FConstObject JsonObject)
 	END_JSON_SERIALIZE
 }
 
+void FCSTypeReferenceReflectionData::Serialize(FArchive& Ar)
+{
+	Ar << AssemblyName;
+	FieldName.Serialize(Ar);
+	SerializeArray(Ar, SourceGeneratorDependencies);
+	SerializeArray(Ar, MetaData);
+}
+
 UCSManagedAssembly* FCSTypeReferenceReflectionData::GetDefinitionFieldAssembly() const
 {
 	UCSManagedAssembly* Assembly = UCSManager::Get().FindOrLoadAssembly(AssemblyName);
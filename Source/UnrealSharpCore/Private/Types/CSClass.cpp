@@ -1,6 +1,7 @@
 ﻿#include "Types/CSClass.h"
 
 #include "CSManagedAssembly.h"
+#include "Compilers/CSManagedClassCompiler.h"
 #include "UnrealSharpCore.h"
 #include "Utilities/CSClassUtilities.h"
 
@@ -15,27 +16,16 @@ void UCSClass::ManagedObjectConstructor(const FObjectInitializer& ObjectInitiali
 	FirstNativeClass->ClassConstructor(ObjectInitializer);
 
 	// Initialize managed properties that are not zero initialized such as FText.
-	for (UClass* ClassItr = FirstManagedClass; ClassItr != nullptr; ClassItr = ClassItr->GetSuperClass())
+	// Each class keeps its own list, so the chain is walked to pick up the ones of managed super classes.
+	for (UClass* ClassItr = FirstManagedClass; ClassItr && FCSClassUtilities::IsManagedClass(ClassItr); ClassItr = ClassItr->GetSuperClass())
 	{
-		if (!FCSClassUtilities::IsManagedClass(ClassItr))
+		for (FProperty* Property : static_cast<UCSClass*>(ClassItr)->GetPropertiesToInitialize())
 		{
-			break;
-		}
-		
-		for (TFieldIterator<FProperty> PropertyIt(ClassItr, EFieldIterationFlags::None); PropertyIt; ++PropertyIt)
-		{
-			FProperty* Property = *PropertyIt;
-		
-			if (Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
-			{
-				continue;
-			}
-
 			Property->InitializeValue_InContainer(Object);
 		}
 	}
 	
-	if (FirstManagedClass->IsCreationDeferred())
+	if (FirstManagedClass->IsCreationDeferred() || FirstManagedClass->HasLazyManagedObjectCreation())
 	{
 		return;
 	}
@@ -66,6 +56,10 @@ void UCSClass::PostDuplicate(bool bDuplicateForPIE)
 	}
 	
 	SetManagedTypeDefinition(ManagedClass->GetManagedTypeDefinition());
+	SetLazyManagedObjectCreation(ManagedClass->HasLazyManagedObjectCreation());
+	
+	// The duplicated properties are our own, so the list can't be copied over.
+	UCSManagedClassCompiler::CompilePropertiesToInitialize(this);
 }
 
 void UCSClass::PurgeClass(bool bRecompilingOnLoad)
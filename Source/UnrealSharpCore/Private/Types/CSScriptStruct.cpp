@@ -1,13 +1,94 @@
 #include "Types/CSScriptStruct.h"
 
+#include "Algo/AllOf.h"
+
+namespace
+{
+	bool CanHashPropertyMemory(const FProperty* Property)
+	{
+		// Equal floats can differ in bytes (0.0 and -0.0), equal names can differ in display index,
+		// and object references can be unresolved handles that don't match their resolved pointers.
+		if (Property->IsA<FFloatProperty>() || Property->IsA<FDoubleProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FObjectPropertyBase>())
+		{
+			return false;
+		}
+		
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			const UCSScriptStruct* ManagedStruct = Cast<UCSScriptStruct>(StructProperty->Struct);
+			return ManagedStruct && ManagedStruct->CanHashMemory();
+		}
+		
+		return true;
+	}
+}
+
 void UCSScriptStruct::Initialize()
 {
 #if WITH_EDITOR
 	PrimaryStruct = this;
 #endif
 	
+	// Drop what the previous compile derived, so InitializeStruct constructs every member without copying stale defaults.
+	StructFlags = EStructFlags(StructFlags & ~(STRUCT_IsPlainOldData | STRUCT_ZeroConstructor | STRUCT_NoDestructor));
+	PropertiesToCopyFromDefaults.Reset();
+	bCanHashMemory = false;
+	
 	InitializeStructDefaults();
+	
+	// UpdateStructFlags decides zero constructability through InitializeStruct, which needs the defaults to copy by then.
+	UpdatePropertiesToCopyFromDefaults();
 	UpdateStructFlags();
+	UpdatePlainOldDataFlags();
+}
+
+void UCSScriptStruct::InitializeStruct(void* Dest, int32 ArrayDim) const
+{
+	if (!StructDefaults.IsValid())
+	{
+		Super::InitializeStruct(Dest, ArrayDim);
+		return;
+	}
+	
+	const int32 Stride = GetStructureSize();
+	uint8* DestData = static_cast<uint8*>(Dest);
+	
+	if (StructFlags & STRUCT_ZeroConstructor)
+	{
+		FMemory::Memzero(DestData, Stride * ArrayDim);
+		return;
+	}
+	
+	if (StructFlags & STRUCT_IsPlainOldData)
+	{
+		for (int32 Index = 0; Index < ArrayDim; ++Index)
+		{
+			FMemory::Memcpy(DestData + Index * Stride, StructDefaults.Get(), Stride);
+		}
+		return;
+	}
+	
+	// Construct every member as usual, then only copy over the members that have a managed default.
+	InitializeStructIgnoreDefaults(Dest, ArrayDim);
+	
+	for (int32 Index = 0; Index < ArrayDim; ++Index)
+	{
+		void* Element = DestData + Index * Stride;
+		for (const FProperty* Property : PropertiesToCopyFromDefaults)
+		{
+			Property->CopyCompleteValue_InContainer(Element, StructDefaults.Get());
+		}
+	}
+}
+
+uint32 UCSScriptStruct::GetStructTypeHash(const void* Src) const
+{
+	if (bCanHashMemory)
+	{
+		return FCrc::MemCrc32(Src, GetStructureSize());
+	}
+	
+	return Super::GetStructTypeHash(Src);
 }
 
 void UCSScriptStruct::InitializeStructDefaults()
@@ -22,3 +103,73 @@ void UCSScriptStruct::InitializeStructDefaults()
 	DefaultStructInstance = FUserStructOnScopeIgnoreDefaults(this, StructDefaults.Get());
 	DefaultStructInstance.SetPackage(GetOutermost());
 }
+
+void UCSScriptStruct::UpdatePlainOldDataFlags()
+{
+	// Only zero constructible if the managed defaults are zero as well, otherwise new instances need the defaults copied in.
+	const int32 Size = GetStructureSize();
+	const bool bHasZeroDefaults = Algo::AllOf(TConstArrayView<uint8>(StructDefaults.Get(), Size), [](uint8 Byte) { return Byte == 0; });
+	if (!bHasZeroDefaults)
+	{
+		StructFlags = EStructFlags(StructFlags & ~STRUCT_ZeroConstructor);
+	}
+	
+	bool bIsPlainOldData = true;
+	bool bCanHashAllProperties = true;
+	int32 PropertiesSize = 0;
+	
+	for (TFieldIterator<FProperty> PropertyIt(this); PropertyIt; ++PropertyIt)
+	{
+		FProperty* Property = *PropertyIt;
+		
+		if (!Property->HasAllPropertyFlags(CPF_IsPlainOldData | CPF_NoDestructor))
+		{
+			bIsPlainOldData = false;
+			break;
+		}
+		
+		bCanHashAllProperties &= CanHashPropertyMemory(Property);
+		PropertiesSize += Property->GetSize();
+	}
+	
+	if (!bIsPlainOldData)
+	{
+		return;
+	}
+	
+	// Lets the engine copy and destroy instances (and arrays of them) as raw memory instead of property by property.
+	StructFlags = EStructFlags(StructFlags | STRUCT_IsPlainOldData | STRUCT_NoDestructor);
+	
+	if (bHasZeroDefaults)
+	{
+		StructFlags = EStructFlags(StructFlags | STRUCT_ZeroConstructor);
+	}
+	
+	// Padding bytes aren't guaranteed to match between equal values, so only tightly packed structs hash their memory.
+	bCanHashMemory = bCanHashAllProperties && PropertiesSize == Size;
+}
+
+void UCSScriptStruct::UpdatePropertiesToCopyFromDefaults()
+{
+	PropertiesToCopyFromDefaults.Reset();
+	
+	const int32 Size = FMath::Max(GetStructureSize(), 1);
+	TUniquePtr<uint8[]> InitializedData = MakeUnique<uint8[]>(Size);
+	InitializeStructIgnoreDefaults(InitializedData.Get());
+	
+	for (TFieldIterator<FProperty> PropertyIt(this); PropertyIt; ++PropertyIt)
+	{
+		FProperty* Property = *PropertyIt;
+		
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+		{
+			if (!Property->Identical_InContainer(InitializedData.Get(), StructDefaults.Get(), ArrayIndex))
+			{
+				PropertiesToCopyFromDefaults.Add(Property);
+				break;
+			}
+		}
+	}
+	
+	DestroyStruct(InitializedData.Get());
+}
@@ -33,23 +33,21 @@ UCSManagedTypeCompiler* FCSUtilities::ResolveCompilerFromFieldType(ECSFieldType
 	return CompilerClass->GetDefaultObject<UCSManagedTypeCompiler>();
 }
 
-bool FCSUtilities::ShouldReloadDefinition(const TSharedRef<FCSManagedTypeDefinition>& ManagedTypeDefinition, const TCHAR* NewJsonReflectionData)
+ECSTypeStructuralFlags FCSUtilities::GetStructuralChanges(const TSharedRef<FCSManagedTypeDefinition>& ManagedTypeDefinition, uint64 NewStructuralHash, uint64 NewConstructorHash)
 {
-	if (!ManagedTypeDefinition->RequiresCompile())
+	uint8 ChangedFlags = None;
+	
+	if (ManagedTypeDefinition->GetStructuralHash() != NewStructuralHash)
 	{
-		return false;
+		ChangedFlags |= StructuralChanges;
 	}
 	
-	if (ManagedTypeDefinition->HasConstructorChanges())
+	if (ManagedTypeDefinition->GetConstructorHash() != NewConstructorHash)
 	{
-		return true;
+		ChangedFlags |= ConstructorChanges;
 	}
 	
-	const TSharedPtr<FCSTypeReferenceReflectionData> ReflectionData = ManagedTypeDefinition->GetReflectionData();
-	const FString& ExistingReflectionData = ReflectionData->GetRawReflectionData();
-	bool IdenticalReflectionData = ExistingReflectionData.Equals(NewJsonReflectionData, ESearchCase::CaseSensitive);
-	
-	return !IdenticalReflectionData;
+	return static_cast<ECSTypeStructuralFlags>(ChangedFlags);
 }
 
 void FCSUtilities::ParseFunctionFlags(uint32 Flags, TArray<const TCHAR*>& Results)
@@ -35,6 +35,7 @@ struct UNREALSHARPCORE_API FCSFieldName : FCSReflectionDataBase
 
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 private:
 	FName Name;
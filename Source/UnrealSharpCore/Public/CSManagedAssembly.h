@@ -4,6 +4,7 @@
 #include "CSManagedGCHandle.h"
 #include "Logging/StructuredLog.h"
 #include "CSFieldType.h"
+#include "ReflectionData/CSReflectionDataCache.h"
 #include "Misc/Paths.h"
 #include "Utilities/CSClassUtilities.h"
 #include "Utilities/CSUtilities.h"
@@ -15,6 +16,33 @@
 
 struct FCSManagedMethod;
 class UCSClass;
+class UCSManagedTypeCompiler;
+
+// A type registered by the managed side while its assembly is loading. The reflection data is only
+// deserialized once every type of the assembly has been collected, so it can be done in parallel.
+struct FCSPendingTypeRegistration
+{
+	FCSFieldName FieldName;
+	ECSFieldType FieldType = ECSFieldType::Class;
+	UCSManagedTypeCompiler* Compiler = nullptr;
+	uint8* TypeGCHandle = nullptr;
+	
+	uint64 StructuralHash = 0;
+	uint64 ConstructorHash = 0;
+	ECSTypeStructuralFlags ChangedFlags;
+	
+	// Set when the existing definition's reflection data is still up to date, so only its hashes, handle and dirty flags are updated.
+	bool bKeepReflectionData = false;
+	
+	// Only one of these is set, depending on which format the glue generator emitted.
+	TArray<uint8> BinaryReflectionData;
+	FString JsonReflectionData;
+	
+	TSharedPtr<FCSTypeReferenceReflectionData> ReflectionData;
+	
+	// Archived form of ReflectionData, added to the assembly's reflection data cache when it wasn't cached yet.
+	TArray<uint8> CachedReflectionData;
+};
 
 struct FCSAssemblyEvents
 {
@@ -31,6 +59,9 @@ public:
 	void Initialize(FStringView InAssemblyPath, bool bIsCollectible = false);
 
 	UNREALSHARPCORE_API bool LoadAssembly();
+	
+	// The thread-safe part of LoadAssembly: loads the managed assembly and collects its types, without creating any UFields.
+	bool PreloadAssembly();
 	UNREALSHARPCORE_API void UnloadAssembly();
 
 	UNREALSHARPCORE_API bool IsAssemblyLoading() const { return bIsLoading; }
@@ -41,6 +72,8 @@ public:
 	
 	UNREALSHARPCORE_API const TMap<FCSFieldName, TSharedPtr<FCSManagedTypeDefinition>>& GetDefinedManagedTypes() const { return ManagedTypeRegistry; }
 	UNREALSHARPCORE_API bool IsCollectible() const { return bIsCollectible; }
+	
+	void SetUseReflectionDataCache(bool bInUseReflectionDataCache) { bUseReflectionDataCache = bInUseReflectionDataCache; }
 
 #if WITH_EDITOR
 	UNREALSHARPCORE_API void AddDependentAssembly(UCSManagedAssembly* DependencyAssembly) { DependentAssemblies.Add(DependencyAssembly); }
@@ -49,7 +82,9 @@ public:
 
 	TSharedPtr<FGCHandle> FindTypeHandle(const FCSFieldName& FieldName);
 	TSharedPtr<FGCHandle> AddTypeHandle(const FCSFieldName& FieldName, uint8* TypeHandle);
-	TSharedPtr<FGCHandle> FindMethodHandle(const TSharedPtr<FGCHandle>& TypeHandle, const FString& MethodName);
+	
+	// Looks up the Invoke_ method of every UFunction name in one managed call. Returns the number of methods found.
+	int32 FindMethodHandles(const TSharedPtr<FGCHandle>& TypeHandle, TConstArrayView<const TCHAR*> FunctionNames, TArrayView<TSharedPtr<FGCHandle>> OutMethodHandles, TArrayView<void*> OutUnmanagedInvokers);
 
 	TSharedPtr<FCSManagedTypeDefinition> FindOrAddManagedTypeDefinition(UClass* Field);
 	TSharedPtr<FCSManagedTypeDefinition> FindOrAddManagedTypeDefinition(const FCSFieldName& ClassName);
@@ -69,29 +104,46 @@ public:
 		return FCSUtilities::FindField<T>(FieldName);
 	}
 
-	void RegisterManagedType(TCHAR* InFieldName, const TCHAR* InNamespace, ECSFieldType FieldType, uint8* TypeGCHandle, TCHAR* ReflectionJsonString);
+	void RegisterManagedType(TCHAR* InFieldName, const TCHAR* InNamespace, ECSFieldType FieldType, uint8* TypeGCHandle, TCHAR* ReflectionJsonString, uint64 ConstructorHash);
+	void RegisterManagedType(TCHAR* InFieldName, const TCHAR* InNamespace, ECSFieldType FieldType, uint8* TypeGCHandle, const uint8* ReflectionData, int32 ReflectionDataSize, uint64 ConstructorHash);
 
-	TSharedPtr<FGCHandle> CreateManagedObjectFromNative(const UObject* Object);
-	TSharedPtr<FGCHandle> CreateManagedObjectFromNative(const UObject* Object, const TSharedPtr<FGCHandle>& TypeGCHandle);
+	FGCHandle CreateManagedObjectFromNative(const UObject* Object);
+	FGCHandle CreateManagedObjectFromNative(const UObject* Object, const TSharedPtr<FGCHandle>& TypeGCHandle);
 	TSharedPtr<FGCHandle> GetOrCreateManagedInterface(UObject* Object, UClass* InterfaceClass);
 
 	TSharedPtr<const FGCHandle> GetAssemblyHandle() const { return AssemblyHandle; }
 
 private:
+	// Returns whether the registration needs its reflection data, which is false if the existing definition can be kept.
+	bool PrepareTypeRegistration(FCSPendingTypeRegistration& Registration);
+	void QueueTypeRegistration(FCSPendingTypeRegistration&& Registration);
+	
+	void DeserializePendingTypes();
+	void CreatePendingTypes();
+	
 	void OnTypeReflectionDataChanged(TSharedPtr<FCSManagedTypeDefinition> ManagedTypeDefinition);
 
 	TMap<FCSFieldName, TSharedPtr<FCSManagedTypeDefinition>> ManagedTypeRegistry;
 	TArray<TSharedPtr<FCSManagedTypeDefinition>> PendingCompilationTypes;
+	TArray<FCSPendingTypeRegistration> PendingTypeRegistrations;
 	
 	TMap<FCSFieldName, TSharedPtr<FGCHandle>> ManagedTypeHandles;
 	TArray<TSharedPtr<FGCHandle>> ManagedHandles;
 	
 	TSharedPtr<FGCHandle> AssemblyHandle;
+	
+	// Only alive while the assembly is loading.
+	TUniquePtr<FCSReflectionDataCache> ReflectionDataCache;
 
 	FString AssemblyFilePath;
 	
 	bool bIsLoading = false;
+	bool bIsPreloaded = false;
+	bool bPreloadFailed = false;
+	double PreloadTime = 0.0;
+	
 	bool bIsCollectible = false;
+	bool bUseReflectionDataCache = false;
 	
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Transient)
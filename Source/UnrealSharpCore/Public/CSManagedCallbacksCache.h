@@ -16,10 +16,12 @@ struct FCSManagedCallbacks
 	using ManagedCallbacks_InvokeManagedMethod = int(__stdcall*)(void*, void*, void*, void*, void*);
 	using ManagedCallbacks_InvokeDelegate = int(__stdcall*)(FGCHandleIntPtr);
 	using ManagedCallbacks_GetManagedMethod = uint8*(__stdcall*)(void*, const TCHAR*);
+	using ManagedCallbacks_GetManagedMethods = int32(__stdcall*)(void*, const TCHAR* const*, int32, uint8**, void**);
 	using ManagedCallbacks_GetManagedTypeHandle = uint8*(__stdcall*)(uint8*, const TCHAR*);
 	using ManagedCallbacks_InitializeStructure = void(__stdcall*)(FGCHandleIntPtr, void*);
 	using ManagedCallbacks_Dispose = void(__stdcall*)(FGCHandleIntPtr, FGCHandleIntPtr);
 	using ManagedCallbacks_FreeHandle = void(__stdcall*)(FGCHandleIntPtr);
+	using ManagedCallbacks_DisposeBatch = void(__stdcall*)(const FGCHandleIntPtr*, int32);
 		
 	ManagedCallbacks_CreateNewManagedObject CreateNewManagedObject;
 	ManagedCallbacks_CreateNewManagedObjectWrapper CreateNewManagedObjectWrapper;
@@ -28,6 +30,10 @@ struct FCSManagedCallbacks
 		
 	ManagedCallbacks_InvokeDelegate InvokeDelegate;
 	ManagedCallbacks_GetManagedMethod GetManagedMethod;
+	
+	// Takes UFunction names and resolves their Invoke_ methods in one pass over the type,
+	// along with the raw InvokeUnmanaged_ entry points where the type has one.
+	ManagedCallbacks_GetManagedMethods GetManagedMethods;
 	ManagedCallbacks_GetManagedTypeHandle GetManagedTypeHandle;
 	
 	ManagedCallbacks_InitializeStructure InitializeStructure;
@@ -35,9 +41,14 @@ struct FCSManagedCallbacks
 private:
 	friend FGCHandle;
 	friend FScopedGCHandle;
+	friend class UCSManager;
+	friend struct FCSManagedCallbacksInstrumentation;
 	
 	ManagedCallbacks_Dispose Dispose;
 	ManagedCallbacks_FreeHandle FreeHandle;
+	
+	// Takes pairs of an object handle and its assembly handle, disposes the objects and frees the handles.
+	ManagedCallbacks_DisposeBatch DisposeBatch;
 };
 
 inline FCSManagedCallbacks& GetManagedCallbacks()
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+
+class UCSManagedAssembly;
+
+struct FCSManagedObjectSlot
+{
+	// Raw handle to the managed counterpart of the UObject at this slot's GUObjectArray index.
+	FGCHandleIntPtr Handle;
+
+	// The assembly that created the managed counterpart. Needed to dispose the handle into the right load context.
+	UCSManagedAssembly* OwningAssembly = nullptr;
+
+	bool IsEmpty() const { return Handle.ManagedHandlePtr == nullptr; }
+};
+
+// Flat table of managed object handles addressed by GUObjectArray index, chunked like FChunkedFixedUObjectArray.
+// Chunks are allocated on first use and never move, so lookups are a shift and a mask with no hashing.
+class FCSManagedObjectHandleTable
+{
+public:
+	static constexpr int32 NumElementsPerChunk = 16 * 1024;
+
+	FCSManagedObjectHandleTable() = default;
+	~FCSManagedObjectHandleTable();
+
+	FCSManagedObjectHandleTable(const FCSManagedObjectHandleTable&) = delete;
+	FCSManagedObjectHandleTable& operator=(const FCSManagedObjectHandleTable&) = delete;
+
+	// Sizes the chunk directory to the capacity of GUObjectArray. Must be called before any other function.
+	void Initialize(int32 MaxObjects);
+
+	const FCSManagedObjectSlot* Find(int32 Index) const
+	{
+		const FCSManagedObjectSlot* Slot = GetSlot(Index);
+		return Slot && !Slot->IsEmpty() ? Slot : nullptr;
+	}
+
+	FGCHandleIntPtr FindHandle(int32 Index) const
+	{
+		const FCSManagedObjectSlot* Slot = GetSlot(Index);
+		return Slot ? Slot->Handle : FGCHandleIntPtr();
+	}
+
+	void Add(int32 Index, FGCHandleIntPtr Handle, UCSManagedAssembly* OwningAssembly);
+	bool Remove(int32 Index, FCSManagedObjectSlot& OutSlot);
+
+	// Clears the index's bit and returns whether it was set. A cleared bit means the index never had a handle since it was last
+	// removed, so the delete listener can skip the object without touching its slot.
+	bool ConsumeManagedBit(int32 Index)
+	{
+		const uint32 WordIndex = static_cast<uint32>(Index) / 64;
+		if (WordIndex >= static_cast<uint32>(ManagedBits.Num()))
+		{
+			return false;
+		}
+
+		const int64 Mask = int64(1) << (Index % 64);
+		if (!(ManagedBits[WordIndex] & Mask))
+		{
+			return false;
+		}
+
+		return FPlatformAtomics::InterlockedAnd(&ManagedBits[WordIndex], ~Mask) & Mask;
+	}
+
+	// Empties every slot owned by the assembly and returns the handles that were stored in them.
+	void RemoveAll(const UCSManagedAssembly* OwningAssembly, TArray<FGCHandleIntPtr>& OutHandles);
+
+private:
+	const FCSManagedObjectSlot* GetSlot(int32 Index) const
+	{
+		const uint32 ChunkIndex = static_cast<uint32>(Index) / NumElementsPerChunk;
+		if (ChunkIndex >= static_cast<uint32>(Chunks.Num()))
+		{
+			return nullptr;
+		}
+
+		const FCSManagedObjectSlot* Chunk = Chunks[ChunkIndex];
+		return Chunk ? Chunk + Index % NumElementsPerChunk : nullptr;
+	}
+
+	FCSManagedObjectSlot& GetOrAddSlot(int32 Index);
+
+	// Pre-sized in Initialize and never resized afterward, so readers never race with a reallocation.
+	TArray<FCSManagedObjectSlot*> Chunks;
+
+	// One bit per index, set in Add. Bits outlive RemoveAll, which only costs a slot lookup once the object is deleted.
+	TArray<int64> ManagedBits;
+};
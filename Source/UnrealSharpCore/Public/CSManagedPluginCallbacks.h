@@ -6,9 +6,13 @@ struct FCSManagedPluginCallbacks
 {
 	using LoadPluginCallback = FGCHandleIntPtr(__stdcall*)(const TCHAR*, bool);
 	using UnloadPluginCallback = void(__stdcall*)(const TCHAR*);
+	using PreloadPluginCallback = bool(__stdcall*)(const TCHAR*, bool);
 
 	LoadPluginCallback LoadPlugin = nullptr;
 	UnloadPluginCallback UnloadPlugin = nullptr;
+
+	// Loads the assembly and registers its types without starting its modules. Safe to call from worker threads.
+	PreloadPluginCallback PreloadPlugin = nullptr;
 };
 
 inline FCSManagedPluginCallbacks& GetManagedPluginCallbacks() 
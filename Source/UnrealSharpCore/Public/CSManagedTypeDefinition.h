@@ -75,6 +75,15 @@ struct FCSManagedTypeDefinition final : TSharedFromThis<FCSManagedTypeDefinition
 	UNREALSHARPCORE_API bool HasConstructorChanges() const { return EnumHasAnyFlags(DirtyFlags, ConstructorChanges); }
 	UNREALSHARPCORE_API bool RequiresCompile() const { return DirtyFlags != None; }
 	
+	void SetHashes(uint64 InStructuralHash, uint64 InConstructorHash)
+	{
+		StructuralHash = InStructuralHash;
+		ConstructorHash = InConstructorHash;
+	}
+	
+	uint64 GetStructuralHash() const { return StructuralHash; }
+	uint64 GetConstructorHash() const { return ConstructorHash; }
+	
 private:
 
 	// The Unreal reflection type generated for this managed definition.
@@ -94,6 +103,11 @@ private:
 	// Indicates what kind of changes have occurred since last compilation.
 	ECSTypeStructuralFlags DirtyFlags;
 
+	// Hashes of the reflection data and the managed constructor this type was last registered with.
+	// Compared on hot reload to decide which ECSTypeStructuralFlags to set.
+	uint64 StructuralHash = 0;
+	uint64 ConstructorHash = 0;
+
 	// Handle to the underlying managed (C#) type
 	TSharedPtr<FGCHandle> TypeGCHandle;
 };
@@ -2,7 +2,9 @@
 
 #include "CSBindsRegistry.h"
 #include "CSManagedAssembly.h"
+#include "CSManagedObjectHandleTable.h"
 #include "CSObjectID.h"
+#include "Containers/MpscQueue.h"
 #include "CSManager.generated.h"
 
 class UCSScriptStruct;
@@ -15,6 +17,15 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FCSEnumEvent, UCSEnum*);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FCSManagerInitializedEvent, class UCSManager&);
 
+// Handle of a deleted UObject, disposed with the rest of its garbage collection's handles.
+struct FCSPendingHandleDisposal
+{
+	FGCHandleIntPtr Handle;
+	FGCHandleIntPtr AssemblyHandle;
+};
+
+static_assert(sizeof(FCSPendingHandleDisposal) == sizeof(FGCHandleIntPtr) * 2, "Read as pairs of handles by the managed side");
+
 UCLASS(Transient)
 class UCSManager : public UObject, public FUObjectArray::FUObjectDeleteListener
 {
@@ -42,7 +53,7 @@ public:
 	UNREALSHARPCORE_API UPackage* GetGlobalManagedPackage() const { return GlobalManagedPackage; }
 	UNREALSHARPCORE_API const TArray<TObjectPtr<UPackage>>& GetManagedPackages() const { return ManagedPackages; }
 
-	UNREALSHARPCORE_API UCSManagedAssembly* LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible = false);
+	UNREALSHARPCORE_API UCSManagedAssembly* LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible = false, bool bUseReflectionDataCache = false);
 	UNREALSHARPCORE_API UCSManagedAssembly* LoadUserAssemblyByName(FName AssemblyName, bool bIsCollectible = false);
 	UNREALSHARPCORE_API UCSManagedAssembly* LoadPluginAssemblyByName(FName AssemblyName, bool bIsCollectible = false);
 
@@ -70,6 +81,15 @@ public:
 	}
 	
 	UNREALSHARPCORE_API FGCHandle FindManagedObject(const UObject* Object);
+	
+	// Hot path for native to managed calls on an object that is known to be valid.
+	// Reads the object's slot directly and only falls back to FindManagedObject when no counterpart exists yet.
+	FGCHandleIntPtr FindManagedObjectHandle(const UObject* Object)
+	{
+		const FGCHandleIntPtr Handle = ManagedObjectHandles.FindHandle(Object->GetUniqueID());
+		return Handle.ManagedHandlePtr ? Handle : FindManagedObject(Object).GetHandle();
+	}
+	
 	UNREALSHARPCORE_API FGCHandle FindManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass);
 	
 	UNREALSHARPCORE_API void AddOrExecuteOnManagerInitialized(const FCSManagerInitializedEvent::FDelegate& Delegate);
@@ -84,16 +104,46 @@ public:
 	UNREALSHARPCORE_API bool IsManagedPackage(const UPackage* Package) const { return ManagedPackages.Contains(Package); }
 	UNREALSHARPCORE_API bool IsManagedType(const UField* Field) const { return IsManagedPackage(Field->GetOutermost()); }
 	UNREALSHARPCORE_API bool IsLoadingAnyAssembly() const;
+	bool HasInitialized() const { return bHasInitialized; }
+	
+	void SetCurrentWorldContext(UObject* WorldContext)
+	{
+		// Tick-like events set the same context every call, so skip the weak pointer write when nothing changed.
+		if (WorldContext == CurrentWorldContextObject && CurrentWorldContext.IsValid())
+		{
+			return;
+		}
+		
+		CurrentWorldContext = WorldContext;
+		CurrentWorldContextObject = WorldContext;
+	}
 	
-	void SetCurrentWorldContext(UObject* WorldContext) { CurrentWorldContext = WorldContext; }
 	UObject* GetCurrentWorldContext() const { return CurrentWorldContext.Get(); }
 	
-	TMap<FCSObjectID, TSharedPtr<FGCHandle>>& GetManagedObjectHandles() { return ManagedObjectHandles; }
+	FCSManagedObjectHandleTable& GetManagedObjectHandles() { return ManagedObjectHandles; }
+	
+	// Disposes the handles of every UObject deleted since the last flush in a single managed call.
+	// Runs after each garbage collection purge, and before an assembly is unloaded.
+	UNREALSHARPCORE_API void FlushPendingHandleDisposals();
+	
+	// Managed code can run between incremental purge steps, before the post-purge flush.
+	// Called before entering managed code, so it never sees a managed object whose UObject was already deleted.
+	void FlushPendingHandleDisposalsBeforeManagedCall()
+	{
+		if (UNLIKELY(!PendingHandleDisposals.IsEmpty()) && IsInGameThread())
+		{
+			FlushPendingHandleDisposals();
+		}
+	}
+	
 	TMap<FCSObjectID, TMap<FCSObjectID, TSharedPtr<FGCHandle>>>& GetManagedInterfaceWrappers() { return ManagedInterfaceWrapperHandles; }
 
 private:
 	void InitialAssemblyLoad();
-	void OnEnginePreExit() { GUObjectArray.RemoveUObjectDeleteListener(this); }
+	void PreloadAssemblies(const TArray<UCSManagedAssembly*>& LoadOrder);
+	UCSManagedAssembly* FindOrAddAssembly(const FString& AssemblyPath, bool bIsCollectible, bool bUseReflectionDataCache);
+	void OnEnginePreExit();
+	void QueueHandleDisposal(FGCHandle& Handle, FGCHandleIntPtr AssemblyHandle);
 
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UPackage>> ManagedPackages;
@@ -107,10 +157,14 @@ private:
 	UPROPERTY(Transient)
 	TMap<FName, TObjectPtr<UCSManagedAssembly>> Assemblies;
 	
-	TMap<FCSObjectID, TSharedPtr<FGCHandle>> ManagedObjectHandles;
+	FCSManagedObjectHandleTable ManagedObjectHandles;
 	TMap<FCSObjectID, TMap<FCSObjectID, TSharedPtr<FGCHandle>>> ManagedInterfaceWrapperHandles;
+	
+	TMpscQueue<FCSPendingHandleDisposal> PendingHandleDisposals;
+	TArray<FCSPendingHandleDisposal> HandleDisposalBatch;
 
 	TWeakObjectPtr<UObject> CurrentWorldContext;
+	const UObject* CurrentWorldContextObject = nullptr;
 	
 	FCSManagerInitializedEvent OnInitialized;
 
@@ -45,6 +45,7 @@ struct FCSNamespace : FCSReflectionDataBase
 
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 private:
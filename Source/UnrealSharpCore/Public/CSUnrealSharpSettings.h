@@ -24,6 +24,17 @@ public:
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Debugging")
 	bool bCrashOnException = true;
 
+	// Should deserialized reflection data be cached next to the assemblies in the load order manifests?
+	// Unchanged assemblies then skip parsing their reflection data on startup.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bUseReflectionDataCache = true;
+
+	// Should objects of C# classes only get their managed counterpart once C# first accesses them?
+	// Saves the managed allocation for objects that never run C# code, but delays their C# constructor until then.
+	// Individual classes can opt in with [LazyManagedObject] instead.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bLazyManagedObjectCreation = false;
+
 	bool HasNamespaceSupport() const;
 
 protected:
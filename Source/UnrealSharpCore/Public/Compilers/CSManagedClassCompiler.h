@@ -27,6 +27,9 @@ public:
 	
 	static UObject* CreateDeferredManagedCDO(UCSClass* ManagedClass);
 	static void FinalizeManagedCDO(UCSClass* ManagedClass);
+	
+	// Flattens the managed properties that need initialization, so object construction doesn't have to iterate the class chain.
+	static void CompilePropertiesToInitialize(UCSClass* ManagedClass);
 
 	static void ActivateSubsystem(TSubclassOf<USubsystem> SubsystemClass);
 	static void DeactivateSubsystem(TSubclassOf<USubsystem> SubsystemClass);
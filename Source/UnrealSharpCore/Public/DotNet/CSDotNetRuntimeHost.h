@@ -6,8 +6,9 @@
 
 struct FCSManagedCallbacks;
 struct FCSManagedPluginCallbacks;
+struct FCSBindsCallbacks;
 
-using FInitializeRuntimeHost = bool (*)(const TCHAR*, const TCHAR*, FCSManagedPluginCallbacks*, const void*, FCSManagedCallbacks*);
+using FInitializeRuntimeHost = bool (*)(const TCHAR*, const TCHAR*, FCSManagedPluginCallbacks*, const FCSBindsCallbacks*, FCSManagedCallbacks*);
 
 class FCSDotNetRuntimeHost
 {
@@ -16,6 +16,9 @@ public:
 	static void GetOverriddenFunctions(const UClass* Outer, const TSharedPtr<const FCSClassReflectionData>& ClassReflectionData, TArray<UFunction*>& VirtualFunctions);
 	UNREALSHARPCORE_API static void GenerateVirtualFunctions(UClass* Outer, const TSharedPtr<const FCSClassReflectionData>& ClassReflectionData);
 	UNREALSHARPCORE_API static void GenerateFunctions(UClass* Outer, const TArray<FCSFunctionReflectionData>& FunctionsReflectionData);
+	
+	// Call once all functions of the class have been generated.
+	UNREALSHARPCORE_API static void UpdateMethodHandles(UClass* Outer);
 
 	static void AddFunctionToOuter(UClass* Outer, UCSFunctionBase* Function);
 	
@@ -14,17 +14,24 @@ public:
 	static UCSPropertyGenerator* GetPropertyGenerator(ECSPropertyType PropertyType)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCSPropertyFactory::GetPropertyGenerator);
-		EnsureInitialized();
-		
-		const uint32 Hash = static_cast<uint32>(PropertyType);
-		UCSPropertyGenerator** FoundGenerator = PropertyGeneratorMap.FindByHash(Hash, Hash);
+		UCSPropertyGenerator* FoundGenerator = FindPropertyGenerator(PropertyType);
 		
 		if (!FoundGenerator)
 		{
 			UE_LOGFMT(LogUnrealSharp, Fatal, "No property generator found for property type: {0}", static_cast<uint8>(PropertyType));
 		}
 
-		return *FoundGenerator;
+		return FoundGenerator;
+	}
+	
+	// Returns null instead of asserting, for property types read from untrusted data such as the reflection data cache.
+	static UCSPropertyGenerator* FindPropertyGenerator(ECSPropertyType PropertyType)
+	{
+		EnsureInitialized();
+		
+		const uint32 Hash = static_cast<uint32>(PropertyType);
+		UCSPropertyGenerator** FoundGenerator = PropertyGeneratorMap.FindByHash(Hash, Hash);
+		return FoundGenerator ? *FoundGenerator : nullptr;
 	}
 	
 	UNREALSHARPCORE_API static FProperty* CreateProperty(UField* Outer, const FCSPropertyReflectionData& PropertyReflectionData);
@@ -38,7 +45,9 @@ public:
 	UNREALSHARPCORE_API static void CreateAndAssignProperties(UField* Outer, const TArray<FCSPropertyReflectionData>& PropertyReflectionData, const TFunction<void(FProperty*)>& OnPropertyCreated = nullptr);
 	UNREALSHARPCORE_API static void TryAddPropertyAsFieldNotify(const FCSPropertyReflectionData& PropertyReflectionData, UBlueprintGeneratedClass* Class);
 
-private:
+	// Gathers the property generators. Must run on the game thread before reflection data is deserialized on worker threads.
 	static void EnsureInitialized();
+
+private:
 	static TMap<uint32, UCSPropertyGenerator*> PropertyGeneratorMap;
 };
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "CSManagedGCHandle.h"
+#include "CSFunctionCallPlan.h"
+#include "CSManagedCallbacksCache.h"
 #include "CSFunction.generated.h"
 
 struct FGCHandle;
@@ -18,14 +20,33 @@ public:
 	
 	bool UpdateMethodHandle();
 	
+	// Resolves the method handles of every managed function declared in the class with a single managed call.
+	static bool UpdateMethodHandles(UClass* Class);
+	
 	bool IsOwnedByManagedClass() const;
 
 	bool HasValidMethodHandle() const
 	{
 		return MethodHandle.IsValid() && !MethodHandle->IsNull();
 	}
+
+	void SetCallPlan(FCSFunctionCallPlan&& InCallPlan) { CallPlan = MoveTemp(InCallPlan); }
+	const FCSFunctionCallPlan& GetCallPlan() const { return CallPlan; }
 	
 	static void InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL);
 private:
+	// Kept out of line so the success path of InvokeManagedMethod stays small.
+	static FORCENOINLINE void HandleManagedException(UObject* ObjectToInvokeOn, FFrame& Stack, const FString& ExceptionMessage);
+	
 	TSharedPtr<FGCHandle> MethodHandle = nullptr;
+	
+	// Generated InvokeUnmanaged_ entry point, called instead of the generic dispatcher when available.
+	// Only valid while MethodHandle is, since both come from the same assembly load.
+	using FUnmanagedInvoker = int32(__stdcall*)(void*, void*, void*, void*);
+	FUnmanagedInvoker UnmanagedInvoker = nullptr;
+	
+	// Interop stats counter of UnmanagedInvoker, registered when it's first resolved. Only used with UNREALSHARP_INTEROP_STATS.
+	int32 InvokerCounterIndex = INDEX_NONE;
+	
+	FCSFunctionCallPlan CallPlan;
 };
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FCSParameterStep
+{
+	FProperty* Property = nullptr;
+
+	// Offset of the parameter inside the function's parameter struct.
+	int32 Offset = 0;
+
+	// Out and reference parameters may resolve to the caller's address, which is copied into the local buffer.
+	bool bIsOutParm = false;
+
+	// Non-const out parameters are written back to the caller's address after the managed method returns.
+	bool bCopyBack = false;
+};
+
+// Flattened description of a UCSFunctionBase's parameters, compiled once when the function is created.
+// InvokeManagedMethod_Params replays this instead of walking the function's properties on every Blueprint call.
+struct FCSFunctionCallPlan
+{
+	static FCSFunctionCallPlan Compile(const UFunction* Function);
+
+	bool IsCompiled() const { return bIsCompiled; }
+
+	// Every parameter except the return value, in declaration order.
+	TArray<FCSParameterStep> Parameters;
+
+	// Parameters (including the return value) that are not zero constructed and need InitializeValue after the buffer is zeroed.
+	TArray<FProperty*> PropertiesToInitialize;
+
+	// Parameters (including the return value) that own memory and need DestroyValue after the call.
+	TArray<FProperty*> PropertiesToDestroy;
+
+	int32 NumCopyBackParms = 0;
+	int32 ParmsSize = 0;
+
+	bool bIsCompiled = false;
+};
@@ -8,6 +8,7 @@ struct FCSClassBaseReflectionData : FCSStructReflectionData
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 	
 	TArray<FCSFunctionReflectionData> Functions;
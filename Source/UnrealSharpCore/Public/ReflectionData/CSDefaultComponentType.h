@@ -6,6 +6,7 @@ struct FCSDefaultComponentType : FCSFieldType
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 	bool HasValidAttachment() const { return AttachmentComponent != NAME_None; }
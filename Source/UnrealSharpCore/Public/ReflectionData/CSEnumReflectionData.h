@@ -6,6 +6,7 @@ struct FCSEnumReflectionData : FCSTypeReferenceReflectionData
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 	TArray<FString> EnumNames;
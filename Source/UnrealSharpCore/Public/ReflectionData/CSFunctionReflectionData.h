@@ -6,6 +6,7 @@ struct FCSFunctionReflectionData : FCSStructReflectionData
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 	const FCSPropertyReflectionData* TryGetReturnValue() const
@@ -11,6 +11,7 @@ struct UNREALSHARPCORE_API FCSPropertyReflectionData : FCSTypeReferenceReflectio
 
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 	FName GetName() const { return FieldName.GetFName(); }
@@ -40,4 +41,7 @@ struct UNREALSHARPCORE_API FCSPropertyReflectionData : FCSTypeReferenceReflectio
 	
 	TSharedPtr<FCSFunctionReflectionData> GetterMethod;
 	TSharedPtr<FCSFunctionReflectionData> SetterMethod;
+
+private:
+	static void SerializeAccessor(FArchive& Ar, TSharedPtr<FCSFunctionReflectionData>& Accessor);
 };
@@ -12,4 +12,45 @@ public:
 	virtual ~FCSReflectionDataBase() = default;
 protected:
 	virtual bool Serialize(FConstObject JsonObject) = 0;
+	
+	// Binary form used by the on-disk reflection data cache, see FCSReflectionDataCache.
+	virtual void Serialize(FArchive& Ar) = 0;
+	
+	template<typename T>
+	static void SerializeArray(FArchive& Ar, TArray<T>& Array)
+	{
+		int32 Num = Array.Num();
+		Ar << Num;
+		
+		if (Ar.IsLoading())
+		{
+			// Every element takes at least a byte, so a count larger than what's left can only come from a corrupt cache.
+			if (Ar.IsError() || Num < 0 || Num > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				Array.Reset();
+				return;
+			}
+			
+			Array.SetNum(Num);
+		}
+		
+		for (T& Element : Array)
+		{
+			Element.Serialize(Ar);
+			
+			if (Ar.IsError())
+			{
+				return;
+			}
+		}
+	}
+	
+	template<typename EnumType>
+	static void SerializeEnum(FArchive& Ar, EnumType& Value)
+	{
+		std::underlying_type_t<EnumType> RawValue = static_cast<std::underlying_type_t<EnumType>>(Value);
+		Ar << RawValue;
+		Value = static_cast<EnumType>(RawValue);
+	}
 };
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSFieldName.h"
+
+struct FCSTypeReferenceReflectionData;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// On-disk cache of deserialized reflection data, stored next to an assembly as <Assembly>.reflectioncache.
+// The cache is keyed by a hash of the assembly file and of the engine and plugin versions, and is discarded as a whole once any of them change.
+class FCSReflectionDataCache
+{
+public:
+	explicit FCSReflectionDataCache(const FString& InAssemblyFilePath);
+	~FCSReflectionDataCache();
+
+	// Maps the cache file into memory if it was written for the assembly currently on disk.
+	void Load();
+
+	// Writes the cache back to disk if any type was added since it was loaded.
+	void Save();
+
+	// Safe to call from worker threads, as long as no types are added concurrently.
+	bool Read(const FCSFieldName& FieldName, uint64 StructuralHash, FCSTypeReferenceReflectionData& OutReflectionData) const;
+
+	void Add(const FCSFieldName& FieldName, uint64 StructuralHash, TArray<uint8>&& SerializedData);
+
+	static TArray<uint8> SerializeReflectionData(FCSTypeReferenceReflectionData& ReflectionData);
+
+private:
+	static constexpr uint32 Magic = 0x43525355; // "USRC"
+
+	// Bump whenever a reflection data type changes its FArchive layout.
+	static constexpr uint32 Version = 2;
+
+	struct FCachedType
+	{
+		uint64 StructuralHash = 0;
+		int64 Offset = 0;
+		int64 Size = 0;
+
+		// Only set for types added since the cache was loaded.
+		TArray<uint8> Data;
+	};
+
+	TConstArrayView<uint8> GetCachedData(const FCachedType& CachedType) const;
+	void Unmap();
+
+	FString AssemblyFilePath;
+	FString CacheFilePath;
+	uint64 AssemblyHash = 0;
+	uint64 BuildHash = 0;
+
+	TMap<FCSFieldName, FCachedType> CachedTypes;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	const uint8* DataStart = nullptr;
+
+	bool bIsDirty = false;
+};
@@ -7,6 +7,7 @@ struct FCSStructReflectionData : FCSTypeReferenceReflectionData
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 	
 	TArray<FCSPropertyReflectionData> Properties;
@@ -5,6 +5,7 @@ struct FCSTemplateType : FCSUnrealType
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 	const FCSPropertyReflectionData* GetTemplateArgument(int32 Index) const
@@ -18,6 +18,7 @@ struct FCSMetaDataEntry : FCSReflectionDataBase
 
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 
 	FString Key;
@@ -27,9 +28,13 @@ struct FCSMetaDataEntry : FCSReflectionDataBase
 struct FCSTypeReferenceReflectionData : FCSReflectionDataBase
 {
 	void SerializeFromJsonString(TCHAR* RawJsonString);
+	void SerializeFromBinary(const uint8* Data, int32 Size);
+	
+	static uint64 HashJsonString(const TCHAR* RawJsonString);
 	
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override;
+	virtual void Serialize(FArchive& Ar) override;
 	// End of FCSReflectionDataBase interface
 	
 	bool IsValid() const { return FieldName.IsValid() && AssemblyName != NAME_None; }
@@ -71,8 +76,7 @@ struct FCSTypeReferenceReflectionData : FCSReflectionDataBase
 	FName AssemblyName;
 	TArray<FCSMetaDataEntry> MetaData;
 	TArray<FCSFieldName> SourceGeneratorDependencies;
-	const FString& GetRawReflectionData() const { return RawReflectionData; }
 	
 private:
-	FString RawReflectionData;
+	void SerializeFromDocument(const FDocument& Document);
 };
@@ -7,6 +7,7 @@ struct FCSUnrealType : FCSReflectionDataBase
 {
 	// FCSReflectionDataBase interface
 	virtual bool Serialize(FConstObject JsonObject) override { return true; }
+	virtual void Serialize(FArchive& Ar) override {}
 	// End of FCSReflectionDataBase interface
 
 	ECSPropertyType PropertyType = ECSPropertyType::Unknown;
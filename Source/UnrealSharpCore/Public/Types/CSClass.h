@@ -35,8 +35,21 @@ public:
 	void SetDeferredCreation(bool bInDeferredCreation) { bDeferredCreation = bInDeferredCreation; }
 	bool IsCreationDeferred() const { return bDeferredCreation; }
 	
+	// Instances of lazy classes only get their managed counterpart on the first FindManagedObject.
+	void SetLazyManagedObjectCreation(bool bInLazyManagedObjectCreation) { bLazyManagedObjectCreation = bInLazyManagedObjectCreation; }
+	bool HasLazyManagedObjectCreation() const { return bLazyManagedObjectCreation; }
+	
+	void SetPropertiesToInitialize(TArray<FProperty*>&& InPropertiesToInitialize) { PropertiesToInitialize = MoveTemp(InPropertiesToInitialize); }
+	const TArray<FProperty*>& GetPropertiesToInitialize() const { return PropertiesToInitialize; }
+	
 private:
+	// Properties declared by this class that aren't zero initialized, such as FText. Only covers this class,
+	// so a recompiled super class can't leave stale properties in its subclasses' lists.
+	TArray<FProperty*> PropertiesToInitialize;
+	
+
 	bool bDeferredCreation = true;
+	bool bLazyManagedObjectCreation = false;
 	
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Transient)
@@ -15,9 +15,25 @@ public:
 	virtual bool IsNameStableForNetworking() const override { return true; }
 	// End of UObject interface
 	
+	// UScriptStruct interface
+	virtual void InitializeStruct(void* Dest, int32 ArrayDim = 1) const override;
+	virtual uint32 GetStructTypeHash(const void* Src) const override;
+	// End of UScriptStruct interface
+	
 	void Initialize();
 	
+	bool CanHashMemory() const { return bCanHashMemory; }
+	
 private:
 	void InitializeStructDefaults();
+	void UpdatePlainOldDataFlags();
+	void UpdatePropertiesToCopyFromDefaults();
+	
 	TUniquePtr<uint8[]> StructDefaults;
+	
+	// Properties whose managed default differs from what InitializeValue produces. POD structs copy their defaults as a whole instead.
+	TArray<FProperty*> PropertiesToCopyFromDefaults;
+	
+	// Set for POD structs without padding or floating point members, where equal values always have equal bytes.
+	bool bCanHashMemory = false;
 };
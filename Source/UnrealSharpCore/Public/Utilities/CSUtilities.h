@@ -6,6 +6,7 @@
 #include "Logging/StructuredLog.h"
 
 struct FCSManagedTypeDefinition;
+enum ECSTypeStructuralFlags : uint8;
 class UCSManagedAssembly;
 struct FCSTypeReferenceReflectionData;
 class UCSManagedTypeCompiler;
@@ -13,7 +14,7 @@ class UCSManagedTypeCompiler;
 namespace FCSUtilities
 {
 	UCSManagedTypeCompiler* ResolveCompilerFromFieldType(ECSFieldType FieldType);
-	bool ShouldReloadDefinition(const TSharedRef<FCSManagedTypeDefinition>& ManagedTypeDefinition, const TCHAR* NewJsonReflectionData);
+	ECSTypeStructuralFlags GetStructuralChanges(const TSharedRef<FCSManagedTypeDefinition>& ManagedTypeDefinition, uint64 NewStructuralHash, uint64 NewConstructorHash);
 	
 	UNREALSHARPCORE_API void ParseFunctionFlags(uint32 Flags, TArray<const TCHAR*>& Results);
 	UNREALSHARPCORE_API void ParsePropertyFlags(EPropertyFlags InFlags, TArray<const TCHAR*>& Results);
@@ -0,0 +1,632 @@
+#include "Benchmarks/CSInteropBenchmarkCommandlet.h"
+
+#include "CSBindsRegistry.h"
+#include "CSManager.h"
+#include "UnrealSharpEditor.h"
+#include "Dom/JsonObject.h"
+#include "Functions/CSFunction.h"
+#include "Interfaces/IPluginManager.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	// Forwards to the real allocator and counts the allocations of threads that opted in through FScopedCount.
+	// Installed once and never removed, so threads that already read GMalloc never see it go away.
+	class FCSCountingMalloc final : public FMalloc
+	{
+	public:
+		// Counts the allocations made on the current thread for as long as it's in scope.
+		struct FScopedCount
+		{
+			FScopedCount() { BeginCount(); }
+			~FScopedCount() { EndCount(); }
+		};
+
+		static void BeginCount()
+		{
+			// Installs the counting allocator on first use.
+			Get();
+
+			NumAllocations = 0;
+			NumBytes = 0;
+			bCountAllocations = true;
+		}
+
+		static void EndCount()
+		{
+			bCountAllocations = false;
+		}
+
+		static FCSCountingMalloc& Get()
+		{
+			static FCSCountingMalloc* CountingMalloc = []
+			{
+				FCSCountingMalloc* NewMalloc = new FCSCountingMalloc(GMalloc);
+				FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), NewMalloc);
+				return NewMalloc;
+			}();
+			
+			return *CountingMalloc;
+		}
+
+		static uint64 GetNumAllocations() { return NumAllocations; }
+		static uint64 GetNumBytes() { return NumBytes; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Record(Count);
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			InnerMalloc->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return InnerMalloc->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			InnerMalloc->Trim(bTrimThreadCaches);
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return InnerMalloc->IsInternallyThreadSafe();
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return InnerMalloc->GetDescriptiveName();
+		}
+
+	private:
+		explicit FCSCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		static void Record(SIZE_T Count)
+		{
+			if (bCountAllocations)
+			{
+				++NumAllocations;
+				NumBytes += Count;
+			}
+		}
+
+		FMalloc* InnerMalloc;
+
+		static thread_local bool bCountAllocations;
+		static thread_local uint64 NumAllocations;
+		static thread_local uint64 NumBytes;
+	};
+
+	thread_local bool FCSCountingMalloc::bCountAllocations = false;
+	thread_local uint64 FCSCountingMalloc::NumAllocations = 0;
+	thread_local uint64 FCSCountingMalloc::NumBytes = 0;
+
+	struct FCSBenchmarkResult
+	{
+		FString Name;
+		int64 Iterations = 0;
+		double NanosecondsPerOp = 0.0;
+		double AllocationsPerOp = 0.0;
+		double BytesPerOp = 0.0;
+		// Only set for the benchmarks driven from C#.
+		TOptional<double> ManagedBytesPerOp;
+		FString SkipReason;
+	};
+
+	template <typename FunctionType>
+	FunctionType FindBoundFunction(const TCHAR* BinderName, const TCHAR* FunctionName)
+	{
+		void* FunctionPointer = FCSBindsRegistry::GetBoundFunction(BinderName, FunctionName, static_cast<int32>(GetFunctionSize(static_cast<FunctionType>(nullptr))));
+
+		if (!FunctionPointer)
+		{
+			UE_LOGFMT(LogUnrealSharpEditor, Fatal, "Bound function {0}.{1} is missing or has changed signature", BinderName, FunctionName);
+		}
+
+		return reinterpret_cast<FunctionType>(FunctionPointer);
+	}
+
+	class FCSInteropBenchmarkRunner
+	{
+	public:
+		explicit FCSInteropBenchmarkRunner(int64 InIterations) : Iterations(InIterations)
+		{
+		}
+
+		static int64 GetNumWarmupIterations(int64 NumIterations)
+		{
+			return FMath::Min<int64>(NumIterations / 10, 1000);
+		}
+
+		// Runs Body for a short warmup and then the measured iterations, counting the allocations this thread makes in the latter.
+		// The measured iterations continue the index after the warmup, so Body never sees the same index twice.
+		template <typename BodyType>
+		void Run(const FString& Name, int64 NumIterations, BodyType&& Body)
+		{
+			const int64 NumWarmupIterations = GetNumWarmupIterations(NumIterations);
+			for (int64 Index = 0; Index < NumWarmupIterations; ++Index)
+			{
+				Body(Index);
+			}
+
+			uint64 StartCycles;
+			uint64 EndCycles;
+			uint64 NumAllocations;
+			uint64 NumBytes;
+			{
+				FCSCountingMalloc::FScopedCount ScopedCount;
+
+				StartCycles = FPlatformTime::Cycles64();
+				for (int64 Index = NumWarmupIterations; Index < NumWarmupIterations + NumIterations; ++Index)
+				{
+					Body(Index);
+				}
+				EndCycles = FPlatformTime::Cycles64();
+
+				NumAllocations = FCSCountingMalloc::GetNumAllocations();
+				NumBytes = FCSCountingMalloc::GetNumBytes();
+			}
+
+			AddResult(Name, NumIterations, FPlatformTime::ToMilliseconds64(EndCycles - StartCycles) * 1000000.0, NumAllocations, NumBytes);
+		}
+
+		FCSBenchmarkResult& AddResult(const FString& Name, int64 NumIterations, double Nanoseconds, uint64 NumAllocations, uint64 NumBytes)
+		{
+			FCSBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+			Result.Name = Name;
+			Result.Iterations = NumIterations;
+			Result.NanosecondsPerOp = Nanoseconds / NumIterations;
+			Result.AllocationsPerOp = static_cast<double>(NumAllocations) / NumIterations;
+			Result.BytesPerOp = static_cast<double>(NumBytes) / NumIterations;
+
+			UE_LOGFMT(LogUnrealSharpEditor, Display, "{0}: {1} ns/op, {2} allocs/op", Name, Result.NanosecondsPerOp, Result.AllocationsPerOp);
+			return Result;
+		}
+
+		template <typename BodyType>
+		void Run(const FString& Name, BodyType&& Body)
+		{
+			Run(Name, Iterations, Forward<BodyType>(Body));
+		}
+
+		void Skip(const FString& Name, const FString& Reason)
+		{
+			FCSBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+			Result.Name = Name;
+			Result.SkipReason = Reason;
+
+			UE_LOGFMT(LogUnrealSharpEditor, Display, "{0}: skipped, {1}", Name, Reason);
+		}
+
+		const TArray<FCSBenchmarkResult>& GetResults() const { return Results; }
+
+		const int64 Iterations;
+
+	private:
+		TArray<FCSBenchmarkResult> Results;
+	};
+
+	FProperty* FindPropertyChecked(const UStruct* Struct, FName PropertyName)
+	{
+		FProperty* Property = FindFProperty<FProperty>(Struct, PropertyName);
+		check(Property);
+		return Property;
+	}
+
+	void RunPropertyBenchmarks(FCSInteropBenchmarkRunner& Runner, UCSInteropBenchmarkTarget* Target)
+	{
+		using FGetValueInContainer = void(*)(FProperty*, void*, void*);
+		using FSetValueInContainer = void(*)(FProperty*, void*, void*);
+
+		FGetValueInContainer GetValue_InContainer = FindBoundFunction<FGetValueInContainer>(TEXT("Bind_FProperty"), TEXT("GetValue_InContainer"));
+		FSetValueInContainer SetValue_InContainer = FindBoundFunction<FSetValueInContainer>(TEXT("Bind_FProperty"), TEXT("SetValue_InContainer"));
+
+		FProperty* IntProperty = FindPropertyChecked(UCSInteropBenchmarkTarget::StaticClass(), GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkTarget, IntValue));
+
+		Runner.Run(TEXT("Native.Bind_FProperty.GetValue_InContainer.Int32"), [&](int64 Index)
+		{
+			int32 Value = 0;
+			GetValue_InContainer(IntProperty, Target, &Value);
+		});
+
+		Runner.Run(TEXT("Native.Bind_FProperty.SetValue_InContainer.Int32"), [&](int64 Index)
+		{
+			int32 Value = static_cast<int32>(Index);
+			SetValue_InContainer(IntProperty, Target, &Value);
+		});
+	}
+
+	void RunStringBenchmarks(FCSInteropBenchmarkRunner& Runner)
+	{
+		using FMarshalToNativeStringView = void(*)(FString*, const UTF16CHAR*, int32);
+		using FStringToName = void(*)(FName*, const UTF16CHAR*, int32);
+		using FNameToString = void(*)(FName, FString*);
+		using FTextFromStringView = void(*)(FText*, const TCHAR*, int32);
+		using FTextToStringView = void(*)(FText*, const TCHAR*&, int32&);
+
+		FMarshalToNativeStringView MarshalToNativeStringView = FindBoundFunction<FMarshalToNativeStringView>(TEXT("Bind_FString"), TEXT("MarshalToNativeStringView"));
+		FStringToName StringToName = FindBoundFunction<FStringToName>(TEXT("Bind_FName"), TEXT("StringToName"));
+		FNameToString NameToString = FindBoundFunction<FNameToString>(TEXT("Bind_FName"), TEXT("NameToString"));
+		FTextFromStringView TextFromStringView = FindBoundFunction<FTextFromStringView>(TEXT("Bind_FText"), TEXT("FromStringView"));
+		FTextToStringView TextToStringView = FindBoundFunction<FTextToStringView>(TEXT("Bind_FText"), TEXT("ToStringView"));
+
+		const FString Source = TEXT("UnrealSharp interop benchmark string");
+		const auto Utf16Source = StringCast<UTF16CHAR>(*Source, Source.Len());
+
+		FString NativeString;
+		Runner.Run(TEXT("Native.Bind_FString.MarshalToNativeStringView"), [&](int64 Index)
+		{
+			MarshalToNativeStringView(&NativeString, Utf16Source.Get(), Utf16Source.Length());
+		});
+
+		FName NativeName;
+		Runner.Run(TEXT("Native.Bind_FName.StringToName"), [&](int64 Index)
+		{
+			StringToName(&NativeName, Utf16Source.Get(), Utf16Source.Length());
+		});
+
+		Runner.Run(TEXT("Native.Bind_FName.NameToString"), [&](int64 Index)
+		{
+			NameToString(NativeName, &NativeString);
+		});
+
+		FText NativeText;
+		Runner.Run(TEXT("Native.Bind_FText.FromStringView"), [&](int64 Index)
+		{
+			TextFromStringView(&NativeText, *Source, Source.Len());
+		});
+
+		Runner.Run(TEXT("Native.Bind_FText.ToStringView"), [&](int64 Index)
+		{
+			const TCHAR* OutString = nullptr;
+			int32 OutLength = 0;
+			TextToStringView(&NativeText, OutString, OutLength);
+		});
+	}
+
+	void RunContainerBenchmarks(FCSInteropBenchmarkRunner& Runner, UCSInteropBenchmarkTarget* Target)
+	{
+		using FScriptArrayAppend = void(*)(FScriptArray*, FArrayProperty*, const void*, int32);
+		using FScriptArraySetNumUninitialized = void(*)(FScriptArray*, FArrayProperty*, int32);
+		using FMapAddPair = void(*)(FMapProperty*, const void*, const void*, const void*);
+		using FMapFindPairIndex = int(*)(FMapProperty*, const void*, const void*);
+		using FSetAdd = void(*)(FScriptSet*, FSetProperty*, const void*);
+		using FSetFindIndex = int(*)(FScriptSet*, FSetProperty*, const void*);
+
+		FScriptArrayAppend Append = FindBoundFunction<FScriptArrayAppend>(TEXT("Bind_FScriptArray"), TEXT("Append"));
+		FScriptArraySetNumUninitialized SetNumUninitialized = FindBoundFunction<FScriptArraySetNumUninitialized>(TEXT("Bind_FScriptArray"), TEXT("SetNumUninitialized"));
+		FMapAddPair AddPair = FindBoundFunction<FMapAddPair>(TEXT("Bind_FScriptMapHelper"), TEXT("AddPair"));
+		FMapFindPairIndex FindMapPairIndexFromHash = FindBoundFunction<FMapFindPairIndex>(TEXT("Bind_FScriptMapHelper"), TEXT("FindMapPairIndexFromHash"));
+		FSetAdd SetAdd = FindBoundFunction<FSetAdd>(TEXT("Bind_FScriptSet"), TEXT("Add"));
+		FSetFindIndex SetFindIndex = FindBoundFunction<FSetFindIndex>(TEXT("Bind_FScriptSet"), TEXT("FindIndex"));
+
+		UClass* TargetClass = UCSInteropBenchmarkTarget::StaticClass();
+		FArrayProperty* VectorsProperty = CastFieldChecked<FArrayProperty>(FindPropertyChecked(TargetClass, GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkTarget, Vectors)));
+		FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(FindPropertyChecked(TargetClass, GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkTarget, IntMap)));
+		FSetProperty* SetProperty = CastFieldChecked<FSetProperty>(FindPropertyChecked(TargetClass, GET_MEMBER_NAME_CHECKED(UCSInteropBenchmarkTarget, IntSet)));
+
+		FScriptArray* Vectors = reinterpret_cast<FScriptArray*>(&Target->Vectors);
+		FScriptSet* IntSet = reinterpret_cast<FScriptSet*>(&Target->IntSet);
+
+		TArray<FVector> SourceVectors;
+		SourceVectors.Init(FVector::OneVector, 64);
+		Target->Vectors.Reserve(SourceVectors.Num());
+
+		Runner.Run(TEXT("Native.Bind_FScriptArray.Append.64xFVector"), [&](int64 Index)
+		{
+			SetNumUninitialized(Vectors, VectorsProperty, 0);
+			Append(Vectors, VectorsProperty, SourceVectors.GetData(), SourceVectors.Num());
+		});
+
+		// Keys wrap around so the map stays a fixed size and every add after the first round updates an existing pair.
+		Runner.Run(TEXT("Native.Bind_FScriptMapHelper.AddPair.Int32"), [&](int64 Index)
+		{
+			const int32 Key = static_cast<int32>(Index & 1023);
+			AddPair(MapProperty, &Target->IntMap, &Key, &Key);
+		});
+
+		Runner.Run(TEXT("Native.Bind_FScriptMapHelper.FindMapPairIndexFromHash.Int32"), [&](int64 Index)
+		{
+			const int32 Key = static_cast<int32>(Index & 1023);
+			FindMapPairIndexFromHash(MapProperty, &Target->IntMap, &Key);
+		});
+
+		Runner.Run(TEXT("Native.Bind_FScriptSet.Add.Int32"), [&](int64 Index)
+		{
+			const int32 Element = static_cast<int32>(Index & 1023);
+			SetAdd(IntSet, SetProperty, &Element);
+		});
+
+		Runner.Run(TEXT("Native.Bind_FScriptSet.FindIndex.Int32"), [&](int64 Index)
+		{
+			const int32 Element = static_cast<int32>(Index & 1023);
+			SetFindIndex(IntSet, SetProperty, &Element);
+		});
+	}
+
+	void RunInvokeNativeFunctionBenchmark(FCSInteropBenchmarkRunner& Runner, UCSInteropBenchmarkTarget* Target)
+	{
+		using FInvokeNativeFunction = void(*)(UObject*, UFunction*, uint8*, uint8*);
+		FInvokeNativeFunction InvokeNativeFunction = FindBoundFunction<FInvokeNativeFunction>(TEXT("Bind_UObject"), TEXT("InvokeNativeFunction"));
+
+		UFunction* AddInts = Target->FindFunctionChecked(GET_FUNCTION_NAME_CHECKED(UCSInteropBenchmarkTarget, AddInts));
+
+		uint8* Params = static_cast<uint8*>(FMemory_Alloca(AddInts->ParmsSize));
+		FMemory::Memzero(Params, AddInts->ParmsSize);
+		uint8* ReturnValueAddress = Params + AddInts->ReturnValueOffset;
+
+		Runner.Run(TEXT("Native.Bind_UObject.InvokeNativeFunction.AddInts"), [&](int64 Index)
+		{
+			InvokeNativeFunction(Target, AddInts, Params, ReturnValueAddress);
+		});
+	}
+
+	void RunManagedObjectCreationBenchmark(FCSInteropBenchmarkRunner& Runner)
+	{
+		// Every iteration creates a new object, so this runs fewer iterations to keep the number of live objects down.
+		const int64 NumIterations = FMath::Min<int64>(Runner.Iterations, 10000);
+
+		// One object per warmup and measured iteration, so every measured lookup creates a managed object.
+		const int64 NumObjects = FCSInteropBenchmarkRunner::GetNumWarmupIterations(NumIterations) + NumIterations;
+
+		TArray<UObject*> Objects;
+		Objects.Reserve(NumObjects);
+
+		UPackage* TransientPackage = GetTransientPackage();
+		for (int64 Index = 0; Index < NumObjects; ++Index)
+		{
+			Objects.Add(NewObject<UObject>(TransientPackage));
+		}
+
+		UCSManager& Manager = UCSManager::Get();
+		Runner.Run(TEXT("Native.UCSManager.FindManagedObject.Create"), NumIterations, [&](int64 Index)
+		{
+			Manager.FindManagedObject(Objects[Index]);
+		});
+
+		for (UObject* Object : Objects)
+		{
+			Object->MarkAsGarbage();
+		}
+
+		CollectGarbage(RF_NoFlags);
+	}
+
+	// Called by the C# harness around each measured loop, so native allocations made on behalf of C# are counted too.
+	void BeginManagedSample(void* Context)
+	{
+		FCSCountingMalloc::BeginCount();
+	}
+
+	void EndManagedSample(void* Context, const UTF16CHAR* Name, int64 NumIterations, double Nanoseconds, int64 ManagedBytes)
+	{
+		FCSCountingMalloc::EndCount();
+
+		FCSInteropBenchmarkRunner& Runner = *static_cast<FCSInteropBenchmarkRunner*>(Context);
+		FCSBenchmarkResult& Result = Runner.AddResult(FString::Printf(TEXT("Managed.%s"), StringCast<TCHAR>(Name).Get()), NumIterations, Nanoseconds,
+			FCSCountingMalloc::GetNumAllocations(), FCSCountingMalloc::GetNumBytes());
+		Result.ManagedBytesPerOp = static_cast<double>(ManagedBytes) / NumIterations;
+	}
+
+	void RunManagedBenchmarks(FCSInteropBenchmarkRunner& Runner)
+	{
+		FCSManagedEditorCallbacks::FRunInteropBenchmarks RunInteropBenchmarks = FUnrealSharpEditorModule::Get().GetManagedEditorCallbacks().RunInteropBenchmarks;
+
+		if (!RunInteropBenchmarks)
+		{
+			Runner.Skip(TEXT("Managed"), TEXT("UnrealSharp.Editor hasn't registered its callbacks"));
+			return;
+		}
+
+		using FBeginSample = void(*)(void*);
+		using FEndSample = void(*)(void*, const UTF16CHAR*, int64, double, int64);
+
+		FBeginSample BeginSample = &BeginManagedSample;
+		FEndSample EndSample = &EndManagedSample;
+		RunInteropBenchmarks(Runner.Iterations, &Runner, reinterpret_cast<void*>(BeginSample), reinterpret_cast<void*>(EndSample));
+	}
+
+	void RunManagedFunctionBenchmark(FCSInteropBenchmarkRunner& Runner, const FString& FunctionPath)
+	{
+		const FString BenchmarkName = FString::Printf(TEXT("ProcessEvent.%s"), *FunctionPath);
+
+		FString ClassPath;
+		FString FunctionName;
+		if (!FunctionPath.Split(TEXT(":"), &ClassPath, &FunctionName))
+		{
+			Runner.Skip(BenchmarkName, TEXT("expected <ClassPath>:<FunctionName>"));
+			return;
+		}
+
+		UClass* Class = LoadObject<UClass>(nullptr, *ClassPath);
+		UCSFunctionBase* Function = Class ? Cast<UCSFunctionBase>(Class->FindFunctionByName(*FunctionName)) : nullptr;
+
+		if (!Function)
+		{
+			Runner.Skip(BenchmarkName, TEXT("not a C# UFunction"));
+			return;
+		}
+
+		UObject* Object = NewObject<UObject>(GetTransientPackage(), Class);
+
+		uint8* Params = static_cast<uint8*>(FMemory_Alloca(FMath::Max<int32>(1, Function->ParmsSize)));
+		FMemory::Memzero(Params, Function->ParmsSize);
+		Function->InitializeStruct(Params);
+
+		// Functions without parameters go through a different thunk than the ones with.
+		const TCHAR* ThunkName = Function->NumParms == 0 ? TEXT("InvokeManagedMethod_NoParams") : TEXT("InvokeManagedMethod_Params");
+
+		Runner.Run(FString::Printf(TEXT("%s.%s"), *BenchmarkName, ThunkName), [&](int64 Index)
+		{
+			Object->ProcessEvent(Function, Params);
+		});
+
+		Function->DestroyStruct(Params);
+		Object->MarkAsGarbage();
+	}
+
+	TSharedRef<FJsonObject> ResultsToJson(const TArray<FCSBenchmarkResult>& Results)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("schemaVersion"), 2);
+
+		TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UnrealSharp"));
+		Root->SetStringField(TEXT("pluginVersion"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString());
+		Root->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString(EVersionComponent::Patch));
+		Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+
+		TArray<TSharedPtr<FJsonValue>> Benchmarks;
+		for (const FCSBenchmarkResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> Benchmark = MakeShared<FJsonObject>();
+			Benchmark->SetStringField(TEXT("name"), Result.Name);
+
+			if (!Result.SkipReason.IsEmpty())
+			{
+				Benchmark->SetStringField(TEXT("skipped"), Result.SkipReason);
+			}
+			else
+			{
+				Benchmark->SetNumberField(TEXT("iterations"), Result.Iterations);
+				Benchmark->SetNumberField(TEXT("nsPerOp"), Result.NanosecondsPerOp);
+				Benchmark->SetNumberField(TEXT("allocsPerOp"), Result.AllocationsPerOp);
+				Benchmark->SetNumberField(TEXT("bytesPerOp"), Result.BytesPerOp);
+
+				if (Result.ManagedBytesPerOp.IsSet())
+				{
+					Benchmark->SetNumberField(TEXT("managedBytesPerOp"), Result.ManagedBytesPerOp.GetValue());
+				}
+			}
+
+			Benchmarks.Add(MakeShared<FJsonValueObject>(Benchmark));
+		}
+
+		Root->SetArrayField(TEXT("benchmarks"), Benchmarks);
+		return Root;
+	}
+}
+
+UCSInteropBenchmarkCommandlet::UCSInteropBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UCSInteropBenchmarkCommandlet::Main(const FString& Params)
+{
+	int64 Iterations = 100000;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("UnrealSharp") / TEXT("InteropBenchmark.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString ManagedFunctions;
+	FParse::Value(*Params, TEXT("ManagedFunctions="), ManagedFunctions, false);
+
+	if (!UCSManager::Get().HasInitialized())
+	{
+		UE_LOGFMT(LogUnrealSharpEditor, Error, "The managed runtime isn't initialized, nothing to benchmark");
+		return 1;
+	}
+
+	FCSInteropBenchmarkRunner Runner(FMath::Max<int64>(Iterations, 1));
+
+	// The Managed.* results are driven from C#, so they include the managed->native transition and managed allocations.
+	RunManagedBenchmarks(Runner);
+
+	// The Native.* results call the bound native functions directly, the same way the generated C# code does.
+	// They measure the native half of each edge only, so comparing them to Managed.* shows what the transition costs.
+	UCSInteropBenchmarkTarget* Target = NewObject<UCSInteropBenchmarkTarget>(GetTransientPackage());
+	Target->AddToRoot();
+
+	RunPropertyBenchmarks(Runner, Target);
+	RunStringBenchmarks(Runner);
+	RunContainerBenchmarks(Runner, Target);
+	RunInvokeNativeFunctionBenchmark(Runner, Target);
+	RunManagedObjectCreationBenchmark(Runner);
+
+	TArray<FString> FunctionPaths;
+	ManagedFunctions.ParseIntoArray(FunctionPaths, TEXT(","));
+
+	// Without -ManagedFunctions, fall back to the fixture shipped in UnrealSharp.Editor so both C# function thunks are covered.
+	if (FunctionPaths.IsEmpty())
+	{
+		if (UClass* FixtureClass = FindFirstObject<UClass>(TEXT("InteropBenchmarkFixture"), EFindFirstObjectOptions::ExactClass))
+		{
+			const FString FixturePath = FixtureClass->GetPathName();
+			FunctionPaths.Add(FixturePath + TEXT(":NoParams"));
+			FunctionPaths.Add(FixturePath + TEXT(":AddInts"));
+		}
+		else
+		{
+			Runner.Skip(TEXT("ProcessEvent"), TEXT("InteropBenchmarkFixture isn't loaded and no -ManagedFunctions given"));
+		}
+	}
+
+	for (const FString& FunctionPath : FunctionPaths)
+	{
+		RunManagedFunctionBenchmark(Runner, FunctionPath);
+	}
+
+	Target->RemoveFromRoot();
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(ResultsToJson(Runner.GetResults()), Writer);
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOGFMT(LogUnrealSharpEditor, Error, "Failed to write benchmark results to {0}", OutputPath);
+		return 1;
+	}
+
+	UE_LOGFMT(LogUnrealSharpEditor, Display, "Wrote benchmark results to {0}", FPaths::ConvertRelativePathToFull(OutputPath));
+	return 0;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CSInteropBenchmarkCommandlet.generated.h"
+
+// Holds the properties and functions the interop benchmarks operate on.
+UCLASS(Transient)
+class UCSInteropBenchmarkTarget : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	int32 IntValue = 0;
+
+	UPROPERTY()
+	FString StringValue;
+
+	UPROPERTY()
+	TArray<FVector> Vectors;
+
+	UPROPERTY()
+	TMap<int32, int32> IntMap;
+
+	UPROPERTY()
+	TSet<int32> IntSet;
+
+	UFUNCTION()
+	int32 AddInts(int32 A, int32 B) { return A + B; }
+};
+
+/*
+ * Measures UnrealSharp's interop hot paths and writes the results as JSON, so regressions can be tracked between plugin versions.
+ * Usage: UnrealEditor-Cmd <Project> -run=CSInteropBenchmark -nullrhi -unattended [-Output=<Path>] [-Iterations=<N>] [-ManagedFunctions=<Class:Function,...>]
+ * Managed.* results are driven from C# and Native.* results call the bound native functions directly from C++.
+ * Without -ManagedFunctions, the C# UFunctions of UInteropBenchmarkFixture in UnrealSharp.Editor are measured.
+ */
+UCLASS()
+class UCSInteropBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	UCSInteropBenchmarkCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface
+};
@@ -31,6 +31,7 @@ struct FCSManagedEditorCallbacks
     using FForceManagedGC = void(__stdcall*)();
     using FOpenSolution = bool(__stdcall*)(const TCHAR*, void*);
     using FLoadSignature = void(__stdcall*)(const TCHAR*, void*);
+    using FRunInteropBenchmarks = void(__stdcall*)(int64, void*, void*, void*);
 
     FRecompileDirtyProjects RecompileDirtyProjects = nullptr;
     FRecompileChangedFile RecompileChangedFile = nullptr;
@@ -41,6 +42,8 @@ struct FCSManagedEditorCallbacks
     
     FLoadSignature LoadSolutionAsync = nullptr;
     FLoadSignature LoadProject = nullptr;
+    
+    FRunInteropBenchmarks RunInteropBenchmarks = nullptr;
 };
 
 DECLARE_LOG_CATEGORY_EXTERN(LogUnrealSharpEditor, Log, All);
@@ -43,7 +43,7 @@ public class UnrealSharpEditor : ModuleRules
                 "PluginBrowser", 
                 "UnrealSharpUtilities", 
                 "PlacementMode",
-                "DeveloperToolSettings"
+                "Json"
             }
         );
 
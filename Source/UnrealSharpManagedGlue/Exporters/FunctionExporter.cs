@@ -580,11 +580,34 @@ public class FunctionExporter
         builder.EndUnsafeBlock();
         builder.CloseBrace();
         
+        ExportUnmanagedInvoke(builder, function);
+        
         builder.TryEndWithEditor(function);
         
         builder.AppendLine();
     }
 
+    // Entry point native calls directly instead of going through the generic InvokeManagedMethod dispatcher.
+    static void ExportUnmanagedInvoke(GeneratorStringBuilder builder, UhtFunction function)
+    {
+        string className = function.Outer!.GetStructName();
+        
+        builder.AppendLine();
+        builder.AppendLine("[System.Runtime.InteropServices.UnmanagedCallersOnly]");
+        builder.AppendLine($"static int InvokeUnmanaged_{function.EngineName}(IntPtr managedObjectHandle, IntPtr buffer, IntPtr returnBuffer, IntPtr exceptionTextBuffer)");
+        builder.OpenBrace();
+        builder.AppendLine("try");
+        builder.OpenBrace();
+        builder.AppendLine($"GCHandleUtilities.GetObjectFromHandlePtrFast<{className}>(managedObjectHandle)!.Invoke_{function.EngineName}(buffer, returnBuffer);");
+        builder.AppendLine("return 0;");
+        builder.CloseBrace();
+        builder.AppendLine("catch (Exception ex)");
+        builder.OpenBrace();
+        builder.AppendLine("return UnmanagedCallbacks.HandleInvokeException(ex, exceptionTextBuffer);");
+        builder.CloseBrace();
+        builder.CloseBrace();
+    }
+
     public static FunctionExporter ExportDelegateSignature(GeneratorStringBuilder builder, UhtFunction function, string delegateName)
     {
         FunctionExporter exporter = new FunctionExporter(function);
@@ -83,6 +83,62 @@ bool UnrealSharp::Project::IsAssemblyInAnyManifest(const FString& AssemblyName)
 	return bFound;
 }
 
+bool UnrealSharp::Project::GetAssemblyReferences(const FString& AssemblyPath, TArray<FString>& OutReferences)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UnrealSharp::Project::GetAssemblyReferences);
+	
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FPaths::ChangeExtension(AssemblyPath, TEXT("deps.json"))))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Targets;
+	if (!JsonObject->TryGetObjectField(TEXT("targets"), Targets))
+	{
+		return false;
+	}
+
+	// The assembly's own library is keyed "<Name>/<Version>" under the target, its dependencies are the project and package references.
+	const FString AssemblyName = FPaths::GetBaseFilename(AssemblyPath);
+	
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Target : (*Targets)->Values)
+	{
+		const TSharedPtr<FJsonObject>* Libraries;
+		if (!Target.Value->TryGetObject(Libraries))
+		{
+			continue;
+		}
+		
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Library : (*Libraries)->Values)
+		{
+			FString LibraryName;
+			if (!Library.Key.Split(TEXT("/"), &LibraryName, nullptr) || LibraryName != AssemblyName)
+			{
+				continue;
+			}
+
+			const TSharedPtr<FJsonObject>* LibraryObject;
+			const TSharedPtr<FJsonObject>* Dependencies;
+			
+			if (Library.Value->TryGetObject(LibraryObject) && (*LibraryObject)->TryGetObjectField(TEXT("dependencies"), Dependencies))
+			{
+				(*Dependencies)->Values.GetKeys(OutReferences);
+			}
+			
+			return true;
+		}
+	}
+	
+	return false;
+}
+
 void UnrealSharp::Project::GetAllProjectPaths(TArray<FString>& ProjectPaths)
 {
 	IFileManager::Get().FindFilesRecursive(ProjectPaths, *Paths::GetScriptFolderDirectory(),
@@ -18,6 +18,280 @@ bool UnrealSharp::RapidJson::ParseJsonString(TCHAR* JsonText, FDocument& OutDocu
 	return true;
 }
 
+namespace
+{
+	// Layout: FBinaryJsonHeader, varint string count, each string as varint length + UTF-16 code units,
+	// then a stream of EBinaryJsonToken. Keys and strings are indices into the string table.
+	constexpr uint32 BinaryJsonMagic = 0x4A425355; // "USBJ"
+	constexpr uint16 BinaryJsonVersion = 1;
+
+	struct FBinaryJsonHeader
+	{
+		uint32 Magic;
+		uint16 Version;
+		uint16 Flags;
+		uint64 ContentHash;
+	};
+
+	enum class EBinaryJsonToken : uint8
+	{
+		StartObject,
+		EndObject,
+		StartArray,
+		EndArray,
+		Key,
+		String,
+		Int,
+		True,
+		False,
+		Null,
+		Double,
+	};
+
+	bool ReadBinaryJsonHeader(const uint8* Data, int32 Size, FBinaryJsonHeader& OutHeader)
+	{
+		if (Size < static_cast<int32>(sizeof(FBinaryJsonHeader)))
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(&OutHeader, Data, sizeof(FBinaryJsonHeader));
+		return OutHeader.Magic == BinaryJsonMagic && OutHeader.Version == BinaryJsonVersion;
+	}
+
+	struct FBinaryJsonGenerator
+	{
+		FBinaryJsonGenerator(const uint8* Data, int32 Size)
+			: Cursor(Data)
+			, End(Data + Size)
+		{
+		}
+
+		bool operator()(FDocument& Handler)
+		{
+			return ReadStringTable(Handler.GetAllocator()) && ReadTokens(Handler);
+		}
+
+	private:
+		bool ReadVarUInt(uint64& OutValue)
+		{
+			OutValue = 0;
+			for (int32 Shift = 0; Shift < 64 && Cursor < End; Shift += 7)
+			{
+				const uint8 Byte = *Cursor++;
+				OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+
+				if (!(Byte & 0x80))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool ReadStringTable(FDocument::AllocatorType& Allocator)
+		{
+			uint64 NumStrings;
+			if (!ReadVarUInt(NumStrings) || NumStrings > static_cast<uint64>(End - Cursor))
+			{
+				return false;
+			}
+
+			Strings.SetNumUninitialized(static_cast<int32>(NumStrings));
+			StringLengths.SetNumUninitialized(static_cast<int32>(NumStrings));
+
+			// Strings are stored unaligned and unterminated. Copy each one once into the document's own allocator
+			// so every key and value referencing it can point at the same null-terminated copy.
+			for (int32 i = 0; i < Strings.Num(); ++i)
+			{
+				uint64 Length;
+				if (!ReadVarUInt(Length) || Length * sizeof(TCHAR) > static_cast<uint64>(End - Cursor))
+				{
+					return false;
+				}
+
+				TCHAR* String = static_cast<TCHAR*>(Allocator.Malloc((Length + 1) * sizeof(TCHAR)));
+				FMemory::Memcpy(String, Cursor, Length * sizeof(TCHAR));
+				String[Length] = TCHAR('\0');
+
+				Strings[i] = String;
+				StringLengths[i] = static_cast<rapidjson::SizeType>(Length);
+
+				Cursor += Length * sizeof(TCHAR);
+			}
+
+			return true;
+		}
+
+		bool ReadStringIndex(const TCHAR*& OutString, rapidjson::SizeType& OutLength)
+		{
+			uint64 Index;
+			if (!ReadVarUInt(Index) || Index >= static_cast<uint64>(Strings.Num()))
+			{
+				return false;
+			}
+
+			OutString = Strings[static_cast<int32>(Index)];
+			OutLength = StringLengths[static_cast<int32>(Index)];
+			return true;
+		}
+
+		bool ReadTokens(FDocument& Handler)
+		{
+			TArray<rapidjson::SizeType, TInlineAllocator<16>> ElementCounts;
+
+			// Populate asserts unless the stream produced exactly one value, so anything else is rejected here.
+			int32 NumTopLevelValues = 0;
+
+			while (Cursor < End)
+			{
+				const EBinaryJsonToken Token = static_cast<EBinaryJsonToken>(*Cursor++);
+
+				// Keys aren't elements, everything else counts towards the enclosing container.
+				if (Token != EBinaryJsonToken::Key && Token != EBinaryJsonToken::EndObject && Token != EBinaryJsonToken::EndArray)
+				{
+					if (ElementCounts.Num() > 0)
+					{
+						++ElementCounts.Last();
+					}
+					else if (++NumTopLevelValues > 1)
+					{
+						return false;
+					}
+				}
+				else if (Token == EBinaryJsonToken::Key && ElementCounts.IsEmpty())
+				{
+					return false;
+				}
+
+				switch (Token)
+				{
+				case EBinaryJsonToken::StartObject:
+					Handler.StartObject();
+					ElementCounts.Add(0);
+					break;
+				case EBinaryJsonToken::StartArray:
+					Handler.StartArray();
+					ElementCounts.Add(0);
+					break;
+				case EBinaryJsonToken::EndObject:
+					if (ElementCounts.IsEmpty())
+					{
+						return false;
+					}
+					Handler.EndObject(ElementCounts.Pop(EAllowShrinking::No));
+					break;
+				case EBinaryJsonToken::EndArray:
+					if (ElementCounts.IsEmpty())
+					{
+						return false;
+					}
+					Handler.EndArray(ElementCounts.Pop(EAllowShrinking::No));
+					break;
+				case EBinaryJsonToken::Key:
+				case EBinaryJsonToken::String:
+					{
+						const TCHAR* String;
+						rapidjson::SizeType Length;
+						if (!ReadStringIndex(String, Length))
+						{
+							return false;
+						}
+
+						if (Token == EBinaryJsonToken::Key)
+						{
+							Handler.Key(String, Length, false);
+						}
+						else
+						{
+							Handler.String(String, Length, false);
+						}
+					}
+					break;
+				case EBinaryJsonToken::Int:
+					{
+						uint64 ZigZag;
+						if (!ReadVarUInt(ZigZag))
+						{
+							return false;
+						}
+						Handler.Int64(static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1));
+					}
+					break;
+				case EBinaryJsonToken::True:
+					Handler.Bool(true);
+					break;
+				case EBinaryJsonToken::False:
+					Handler.Bool(false);
+					break;
+				case EBinaryJsonToken::Null:
+					Handler.Null();
+					break;
+				case EBinaryJsonToken::Double:
+					{
+						double Value;
+						if (End - Cursor < static_cast<int64>(sizeof(double)))
+						{
+							return false;
+						}
+						FMemory::Memcpy(&Value, Cursor, sizeof(double));
+						Cursor += sizeof(double);
+						Handler.Double(Value);
+					}
+					break;
+				default:
+					return false;
+				}
+			}
+
+			return ElementCounts.IsEmpty() && NumTopLevelValues == 1;
+		}
+
+		const uint8* Cursor;
+		const uint8* End;
+
+		TArray<const TCHAR*> Strings;
+		TArray<rapidjson::SizeType> StringLengths;
+	};
+}
+
+bool UnrealSharp::RapidJson::ParseBinaryJson(const uint8* Data, int32 Size, FDocument& OutDocument)
+{
+	FBinaryJsonHeader Header;
+	if (!ReadBinaryJsonHeader(Data, Size, Header))
+	{
+		UE_LOGFMT(LogCSJsonUtilties, Error, "Failed to parse binary JSON. Invalid header or unsupported version.");
+		return false;
+	}
+
+	const int32 HeaderSize = sizeof(FBinaryJsonHeader);
+	FBinaryJsonGenerator Generator(Data + HeaderSize, Size - HeaderSize);
+
+	FDocument Result;
+	Result.Populate(Generator);
+
+	if (!Result.IsObject())
+	{
+		UE_LOGFMT(LogCSJsonUtilties, Error, "Failed to parse binary JSON. The token stream is malformed.");
+		return false;
+	}
+
+	OutDocument = MoveTemp(Result);
+	return true;
+}
+
+bool UnrealSharp::RapidJson::ReadBinaryJsonHash(const uint8* Data, int32 Size, uint64& OutHash)
+{
+	FBinaryJsonHeader Header;
+	if (!ReadBinaryJsonHeader(Data, Size, Header))
+	{
+		return false;
+	}
+
+	OutHash = Header.ContentHash;
+	return true;
+}
+
 TOptional<FConstObject> UnrealSharp::RapidJson::GetRootObject(const FDocument& Document)
 {
 	return Document.GetObject();
@@ -29,6 +29,9 @@ namespace UnrealSharp::Project
 {
 	UNREALSHARPUTILITIES_API void DiscoverLoadOrderManifests(TArray<FCSLoadOrderManifest>& OutManifests);
 	UNREALSHARPUTILITIES_API bool IsAssemblyInAnyManifest(const FString& AssemblyName);
+	
+	// Reads the assemblies referenced by AssemblyPath from the .deps.json file written next to it by the build.
+	UNREALSHARPUTILITIES_API bool GetAssemblyReferences(const FString& AssemblyPath, TArray<FString>& OutReferences);
 	UNREALSHARPUTILITIES_API void GetAllProjectPaths(TArray<FString>& ProjectPaths);
 	UNREALSHARPUTILITIES_API FString GetUserManagedProjectName();
 }
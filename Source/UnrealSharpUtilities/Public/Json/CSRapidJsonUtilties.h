@@ -12,6 +12,11 @@ namespace UnrealSharp::RapidJson
 	using FConstArray = FValue::ConstArray;
 	
 	UNREALSHARPUTILITIES_API bool ParseJsonString(TCHAR* JsonText, FDocument& OutDocument);
+	
+	// Builds a document from the compact binary encoding emitted by the glue generator (BinaryJsonWriter),
+	// skipping text tokenization. ReadBinaryJsonHash reads the content hash stored in its header without decoding it.
+	UNREALSHARPUTILITIES_API bool ParseBinaryJson(const uint8* Data, int32 Size, FDocument& OutDocument);
+	UNREALSHARPUTILITIES_API bool ReadBinaryJsonHash(const uint8* Data, int32 Size, uint64& OutHash);
 	UNREALSHARPUTILITIES_API TOptional<FConstObject> GetRootObject(const FDocument& Document);
 	
 	UNREALSHARPUTILITIES_API TOptional<FValue::ConstMemberIterator> FindMember(FConstObject Object, FStringView FieldName);